@@ -0,0 +1,81 @@
+﻿# include "AlphaMask.hpp"
+
+namespace UFOCat::Core
+{
+	AlphaMask::AlphaMask(const Image &rendered)
+		: m_columns{ static_cast<int32>((rendered.width() + CellSize - 1) / CellSize) }
+		, m_size{ rendered.size() }
+	{
+		if (m_columns > 64)
+		{
+			throw Error{ U"AlphaMask: image width {} is too large. (max: {})"_fmt(rendered.width(), CellSize * 64) };
+		}
+
+		const int32 rowCount = (rendered.height() + CellSize - 1) / CellSize;
+		m_rows.resize(rowCount, 0);
+
+		// セルごとに不透明なピクセルの数を数える
+		Array<int32> opaqueCounts(static_cast<size_t>(rowCount) * m_columns, 0);
+
+		for (int32 y = 0; y < rendered.height(); ++y)
+		{
+			for (int32 x = 0; x < rendered.width(); ++x)
+			{
+				if (rendered[y][x].a >= AlphaThreshold)
+				{
+					++opaqueCounts[static_cast<size_t>(y / CellSize) * m_columns + (x / CellSize)];
+				}
+			}
+		}
+
+		// 半分以上が不透明なセルを 1 にする
+		for (int32 row = 0; row < rowCount; ++row)
+		{
+			for (int32 column = 0; column < m_columns; ++column)
+			{
+				// 画像の端のセルは、はみ出した分を除いた実際のピクセル数で判定する
+				const int32 w = Min(CellSize, rendered.width() - column * CellSize);
+				const int32 h = Min(CellSize, rendered.height() - row * CellSize);
+
+				if (opaqueCounts[static_cast<size_t>(row) * m_columns + column] * 2 >= w * h)
+				{
+					m_rows[row] |= (uint64{ 1 } << column);
+				}
+			}
+		}
+	}
+
+	const Size &AlphaMask::size() const noexcept
+	{
+		return m_size;
+	}
+
+	size_t AlphaMask::byteSize() const noexcept
+	{
+		return m_rows.size() * sizeof(uint64);
+	}
+
+	double AlphaMask::agreement(const Image &rendered) const
+	{
+		if (rendered.size() != m_size or rendered.isEmpty())
+		{
+			return 0.0;
+		}
+
+		size_t matched = 0;
+
+		for (int32 y = 0; y < rendered.height(); ++y)
+		{
+			for (int32 x = 0; x < rendered.width(); ++x)
+			{
+				// ピクセルの中心で判定する
+				if ((rendered[y][x].a >= AlphaThreshold) == test(Vec2{ x + 0.5, y + 0.5 }))
+				{
+					++matched;
+				}
+			}
+		}
+
+		return static_cast<double>(matched) / rendered.num_pixels();
+	}
+}
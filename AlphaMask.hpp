@@ -0,0 +1,62 @@
+﻿# pragma once
+
+namespace UFOCat::Core
+{
+	/// @brief 画像の不透明な部分を 1bit ずつで表した当たり判定用のマスク @n
+	/// 1bit が描画サイズでの `CellSize` x `CellSize` px に対応し、1行を `uint64` 1つに詰めて持つ
+	/// @note 猫のテクスチャ (512 x 290 をクリップして 0.3 倍) なら 39 x 22 bit = 176 byte になり、44 種類全部でも 8KB 弱に収まる
+	class AlphaMask
+	{
+	public:
+		/// @brief 1bit が表す正方形の一辺の長さ [描画サイズでの px]
+		constexpr static int32 CellSize = 4;
+
+		/// @brief 不透明とみなすアルファ値の閾値
+		constexpr static uint8 AlphaThreshold = 128;
+
+	private:
+		/// @brief 各行のビット列 下位ビットから順に左の列に対応する
+		Array<uint64> m_rows;
+
+		/// @brief 列数（最大 64）
+		int32 m_columns = 0;
+
+		/// @brief 対応する描画サイズ
+		Size m_size{ 0, 0 };
+
+	public:
+		/// @brief デフォルトコンストラクタ 何も当たらない空のマスクになる
+		AlphaMask() = default;
+
+		/// @brief 描画されるのと同じ大きさの画像からマスクを作る
+		/// @param rendered 描画サイズに縮小済みの画像 横幅は `CellSize * 64` px 以下でなければならない
+		explicit AlphaMask(const Image &rendered);
+
+		/// @brief 対応する描画サイズを取得する
+		/// @return 描画サイズ
+		const Size &size() const noexcept;
+
+		/// @brief マスクが使用しているメモリ量を取得する
+		/// @return バイト数
+		size_t byteSize() const noexcept;
+
+		/// @brief 描画サイズでの座標が不透明な部分かどうかを調べる
+		/// @param local 描画位置の左上を原点とした座標
+		/// @return 不透明な部分なら `true`
+		bool test(const Vec2 &local) const noexcept
+		{
+			if (local.x < 0 or local.y < 0 or local.x >= m_size.x or local.y >= m_size.y)
+			{
+				return false;
+			}
+
+			// 行を引いて、列の位置のビットを見るだけ
+			return (m_rows[static_cast<size_t>(local.y) / CellSize] >> (static_cast<uint32>(local.x) / CellSize)) & 1;
+		}
+
+		/// @brief 描画された画像のアルファ値とマスクがどれだけ一致しているかを調べる
+		/// @param rendered マスクを作ったときと同じ、描画サイズの画像
+		/// @return 一致しているピクセルの割合 (0.0 ~ 1.0)
+		double agreement(const Image &rendered) const;
+	};
+}
@@ -0,0 +1,43 @@
+# version 410
+
+//
+//	UFO猫の毛色を描画時に塗り分けるシェーダ（recolor.hlsl と同じ処理）
+//
+
+uniform sampler2D Texture0;
+uniform sampler2D Texture1;
+
+layout(location = 0) in vec4 Color;
+layout(location = 1) in vec2 UV;
+
+layout(location = 0) out vec4 FragColor;
+
+layout(std140) uniform PSConstants2D
+{
+	vec4 g_colorAdd;
+	vec4 g_sdfParam;
+	vec4 g_sdfOutlineColor;
+	vec4 g_sdfShadowColor;
+	vec4 g_internal;
+};
+
+layout(std140) uniform RecolorConstants
+{
+	vec4 g_regionColors[3];
+};
+
+void main()
+{
+	vec4 base = texture(Texture0, UV);
+	vec3 weights = texture(Texture1, UV).rgb;
+
+	float shade = dot(base.rgb, vec3(0.299, 0.587, 0.114));
+	vec3 tint = (g_regionColors[0].rgb * weights.r)
+		+ (g_regionColors[1].rgb * weights.g)
+		+ (g_regionColors[2].rgb * weights.b);
+
+	float coverage = clamp(weights.r + weights.g + weights.b, 0.0, 1.0);
+	vec3 rgb = mix(base.rgb, tint * shade, coverage);
+
+	FragColor = (vec4(rgb, base.a) * Color) + g_colorAdd;
+}
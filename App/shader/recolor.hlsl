@@ -0,0 +1,52 @@
+//
+//	UFO猫の毛色を描画時に塗り分けるシェーダ
+//	t0: ベース画像（明るい灰色で陰影だけ付けたもの）
+//	t1: 色マスク（R, G, B がそれぞれ 1, 2, 3 番目の毛色の領域の重み）
+//
+
+Texture2D		g_texture0 : register(t0);
+Texture2D		g_texture1 : register(t1);
+SamplerState	g_sampler0 : register(s0);
+SamplerState	g_sampler1 : register(s1);
+
+namespace s3d
+{
+	struct PSInput
+	{
+		float4 position	: SV_POSITION;
+		float4 color	: COLOR0;
+		float2 uv		: TEXCOORD0;
+	};
+}
+
+cbuffer PSConstants2D : register(b0)
+{
+	float4 g_colorAdd;
+	float4 g_sdfParam;
+	float4 g_sdfOutlineColor;
+	float4 g_sdfShadowColor;
+	float4 g_internal;
+}
+
+cbuffer RecolorConstants : register(b1)
+{
+	float4 g_regionColors[3];
+}
+
+float4 PS(s3d::PSInput input) : SV_TARGET
+{
+	const float4 base = g_texture0.Sample(g_sampler0, input.uv);
+	const float3 weights = g_texture1.Sample(g_sampler1, input.uv).rgb;
+
+	// ベース画像の明るさを陰影として、各領域の毛色に掛ける
+	const float shade = dot(base.rgb, float3(0.299, 0.587, 0.114));
+	const float3 tint = (g_regionColors[0].rgb * weights.r)
+		+ (g_regionColors[1].rgb * weights.g)
+		+ (g_regionColors[2].rgb * weights.b);
+
+	// マスクの外（目や鼻など）はベース画像の色をそのまま使う
+	const float coverage = saturate(weights.r + weights.g + weights.b);
+	const float3 rgb = lerp(base.rgb, tint * shade, coverage);
+
+	return (float4(rgb, base.a) * input.color) + g_colorAdd;
+}
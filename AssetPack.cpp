@@ -0,0 +1,284 @@
+﻿# include "AssetPack.hpp"
+# include "Hash.hpp"
+
+namespace
+{
+	/// @brief パックの先頭に置く情報
+	struct Header
+	{
+		uint32 magic;
+		uint32 version;
+		uint32 entryCount;
+		uint32 reserved;
+		/// @brief データ部の位置 [bytes]
+		uint64 dataOffset;
+	};
+
+	/// @brief マニフェストの1項目の、パスより前の部分
+	struct EntryHeader
+	{
+		uint64 offset;
+		uint64 size;
+		uint64 hash;
+		uint32 pathLength;
+		uint32 reserved;
+	};
+}
+
+namespace UFOCat::Util
+{
+	Optional<AssetPack> AssetPack::Open(FilePathView path)
+	{
+		if (not FileSystem::IsFile(path))
+		{
+			return none;
+		}
+
+		auto pack = std::make_shared<Mapped>();
+		pack->file = MemoryMappedFileView{ path };
+
+		if (not pack->file)
+		{
+			return none;
+		}
+
+		const auto mapped = pack->file.mapAll();
+
+		const Byte *const begin = mapped.data;
+		const Byte *const end = begin + mapped.size;
+		const Byte *current = begin;
+
+		// 範囲を確かめてから読む
+		const auto read = [&current, end](void *dst, size_t size)
+		{
+			if (static_cast<size_t>(end - current) < size)
+			{
+				return false;
+			}
+
+			std::memcpy(dst, current, size);
+			current += size;
+			return true;
+		};
+
+		Header header;
+
+		if ((not read(&header, sizeof(header)))
+			or (header.magic != Magic)
+			or (header.version != Version)
+			or (header.dataOffset > mapped.size))
+		{
+			return none;
+		}
+
+		pack->data = begin + header.dataOffset;
+		const uint64 dataSize = mapped.size - header.dataOffset;
+
+		for (uint32 i = 0; i < header.entryCount; ++i)
+		{
+			EntryHeader entry;
+
+			if ((not read(&entry, sizeof(entry)))
+				or (static_cast<size_t>(end - current) < entry.pathLength)
+				or (entry.offset > dataSize)
+				or (entry.size > (dataSize - entry.offset)))
+			{
+				return none;
+			}
+
+			const String logicalPath = Unicode::FromUTF8(std::string_view{ reinterpret_cast<const char *>(current), entry.pathLength });
+			current += entry.pathLength;
+
+			pack->entries.emplace(logicalPath, Entry{ entry.offset, entry.size, entry.hash });
+		}
+
+		AssetPack result;
+		result.m_pack = std::move(pack);
+		return result;
+	}
+
+	bool AssetPack::Build(FilePathView output, const Array<FilePath> &directories)
+	{
+		// 論理パスの順に並べておくと、同じフォルダのアセットが隣り合うので続けて読み込める
+		Array<String> paths;
+
+		for (const auto &directory : directories)
+		{
+			for (const auto &path : FileSystem::DirectoryContents(directory, Recursive::Yes))
+			{
+				if (FileSystem::IsFile(path))
+				{
+					paths << FileSystem::RelativePath(path);
+				}
+			}
+		}
+
+		paths.sort();
+
+		Array<Blob> blobs = paths.map([](const String &path) { return Blob{ path }; });
+
+		// マニフェストの大きさを先に求めて、データ部の位置を決める
+		Array<std::string> utf8Paths = paths.map([](const String &path) { return path.toUTF8(); });
+		uint64 dataOffset = sizeof(Header);
+
+		for (const auto &utf8 : utf8Paths)
+		{
+			dataOffset += sizeof(EntryHeader) + utf8.size();
+		}
+
+		BinaryWriter writer{ output };
+
+		if (not writer)
+		{
+			return false;
+		}
+
+		writer.write(Header{ Magic, Version, static_cast<uint32>(paths.size()), 0, dataOffset });
+
+		uint64 offset = 0;
+
+		for (size_t i = 0; i < paths.size(); ++i)
+		{
+			writer.write(EntryHeader{ offset, blobs[i].size(), Fnv1a(blobs[i].data(), blobs[i].size()), static_cast<uint32>(utf8Paths[i].size()), 0 });
+			writer.write(utf8Paths[i].data(), utf8Paths[i].size());
+			offset += blobs[i].size();
+		}
+
+		for (const auto &blob : blobs)
+		{
+			writer.write(blob.data(), blob.size());
+		}
+
+		return true;
+	}
+
+	bool AssetPack::isPacked() const noexcept
+	{
+		return static_cast<bool>(m_pack);
+	}
+
+	Array<String> AssetPack::list(StringView directory) const
+	{
+		Array<String> results;
+
+		if (m_pack)
+		{
+			// フォルダ直下のもの（それ以降に / を含まないもの）だけを拾う
+			const String prefix = String{ directory } + U'/';
+
+			for (const auto &[path, entry] : m_pack->entries)
+			{
+				if (path.starts_with(prefix) and (not path.substrView(prefix.size()).includes(U'/')))
+				{
+					results << path;
+				}
+			}
+		}
+		else
+		{
+			for (const auto &path : FileSystem::DirectoryContents(directory, Recursive::No))
+			{
+				if (FileSystem::IsFile(path))
+				{
+					results << FileSystem::RelativePath(path);
+				}
+			}
+		}
+
+		return results.sort();
+	}
+
+	bool AssetPack::contains(StringView path) const
+	{
+		return m_pack ? m_pack->entries.contains(String{ path }) : FileSystem::IsFile(path);
+	}
+
+	String AssetPack::fingerprint(StringView path) const
+	{
+		if (m_pack)
+		{
+			if (const auto it = m_pack->entries.find(String{ path }); it != m_pack->entries.end())
+			{
+				return U"{:016X}"_fmt(it->second.hash);
+			}
+
+			return U"";
+		}
+
+		const String writeTime = FileSystem::WriteTime(path).map([](const DateTime &time) { return time.format(); }).value_or(U"");
+
+		return U"{}:{}"_fmt(FileSystem::FileSize(path), writeTime);
+	}
+
+	Optional<std::span<const Byte>> AssetPack::view(StringView path) const
+	{
+		if (not m_pack)
+		{
+			return none;
+		}
+
+		if (const auto it = m_pack->entries.find(String{ path }); it != m_pack->entries.end())
+		{
+			return std::span<const Byte>{ m_pack->data + it->second.offset, static_cast<size_t>(it->second.size) };
+		}
+
+		return none;
+	}
+
+	Optional<ImageInfo> AssetPack::imageInfo(StringView path) const
+	{
+		if (m_pack)
+		{
+			if (const auto bytes = view(path))
+			{
+				MemoryViewReader reader{ bytes->data(), bytes->size() };
+				return ImageDecoder::GetImageInfo(reader, path);
+			}
+
+			return none;
+		}
+
+		return ImageDecoder::GetImageInfo(path);
+	}
+
+	Image AssetPack::loadImage(StringView path) const
+	{
+		if (m_pack)
+		{
+			// マップされたメモリから直接デコードする
+			if (const auto bytes = view(path))
+			{
+				return Image{ MemoryViewReader{ bytes->data(), bytes->size() } };
+			}
+
+			return Image{};
+		}
+
+		return Image{ path };
+	}
+
+	Texture AssetPack::loadTexture(StringView path, TextureDesc desc) const
+	{
+		return m_pack ? Texture{ loadImage(path), desc } : Texture{ path, desc };
+	}
+
+	void AssetPack::registerTexture(AssetNameView name, StringView path, TextureDesc desc) const
+	{
+		if (not m_pack)
+		{
+			TextureAsset::Register(name, FilePath{ path }, desc);
+			return;
+		}
+
+		auto data = std::make_unique<TextureAssetData>(FilePath{ path }, desc);
+
+		// 読み込むときに、ファイルの代わりにパックの中身をデコードする
+		data->onLoad = [pack = *this](TextureAssetData &asset, [[maybe_unused]] const String &hint)
+		{
+			asset.texture = pack.loadTexture(asset.path, asset.desc);
+			return static_cast<bool>(asset.texture);
+		};
+
+		TextureAsset::Register(name, std::move(data));
+	}
+}
@@ -0,0 +1,110 @@
+﻿# pragma once
+# include <span>
+
+namespace UFOCat::Util
+{
+	/// @brief 画像などのアセットを1つのファイルにまとめたパックから、メモリマップで読み込むためのクラス @n
+	/// パックの先頭には、全てのアセットの論理パス（`texture/cat/0.png` など）、位置、サイズ、内容のハッシュ値を並べたマニフェストがあり、
+	/// アセットの一覧や登録はマニフェストを引くだけで済む @n
+	/// パックを使わない場合（開発中など）は、同じインターフェースでばらばらのファイルをそのまま読み込む
+	/// @note コピーしてもパックのメモリマップは共有される 開いた後は読み込み専用なので、ワーカースレッドから使ってもよい
+	class AssetPack
+	{
+	private:
+		/// @brief マニフェストの1項目
+		struct Entry
+		{
+			/// @brief データ部の先頭からの位置 [bytes]
+			uint64 offset;
+
+			/// @brief サイズ [bytes]
+			uint64 size;
+
+			/// @brief 内容のハッシュ値 (FNV-1a 64bit)
+			uint64 hash;
+		};
+
+		/// @brief 開いているパック
+		struct Mapped
+		{
+			MemoryMappedFileView file;
+
+			/// @brief データ部の先頭
+			const Byte *data = nullptr;
+
+			/// @brief 論理パスとマニフェストの項目の対応
+			HashTable<String, Entry> entries;
+		};
+
+		/// @brief 開いているパック ばらばらのファイルを読み込む場合は空
+		std::shared_ptr<const Mapped> m_pack;
+
+	public:
+		/// @brief ファイル先頭の識別子 ("UFAP")
+		constexpr static uint32 Magic = 0x50414655;
+
+		/// @brief フォーマットのバージョン 書き込む内容を変えたら増やす
+		constexpr static uint32 Version = 1;
+
+		/// @brief ばらばらのファイルを読み込むモードで初期化する
+		AssetPack() = default;
+
+		/// @brief パックを開く
+		/// @param path パックのパス
+		/// @return 開いたパック ファイルがない、壊れているなどの場合は `none`
+		static Optional<AssetPack> Open(FilePathView path);
+
+		/// @brief フォルダ内の全てのファイルを1つのパックにまとめる
+		/// @param output 書き出すパックのパス
+		/// @param directories まとめるフォルダ（サブフォルダも含む）
+		/// @return 書き出せたら `true`
+		static bool Build(FilePathView output, const Array<FilePath> &directories);
+
+		/// @brief パックから読み込んでいるかどうか
+		/// @return パックなら `true` ばらばらのファイルなら `false`
+		bool isPacked() const noexcept;
+
+		/// @brief フォルダ直下のアセットの論理パスを、名前順に取得する
+		/// @param directory フォルダの論理パス（`texture/cat` など）
+		/// @return アセットの論理パスのリスト
+		Array<String> list(StringView directory) const;
+
+		/// @brief アセットがあるかどうか
+		/// @param path 論理パス
+		/// @return あれば `true`
+		bool contains(StringView path) const;
+
+		/// @brief アセットの内容が変わったかどうかを調べるための値を取得する @n
+		/// パックならハッシュ値、ばらばらのファイルならサイズと更新日時から作る
+		/// @param path 論理パス
+		/// @return 内容を表す文字列
+		String fingerprint(StringView path) const;
+
+		/// @brief アセットの中身をコピーせずに参照する
+		/// @param path 論理パス
+		/// @return 中身 パックでない場合やアセットがない場合は `none`
+		Optional<std::span<const Byte>> view(StringView path) const;
+
+		/// @brief 画像のヘッダーだけを読んで、大きさなどを取得する
+		/// @param path 論理パス
+		/// @return 画像の情報 読めなければ `none`
+		Optional<ImageInfo> imageInfo(StringView path) const;
+
+		/// @brief 画像を読み込む
+		/// @param path 論理パス
+		/// @return 画像 読めなければ空
+		Image loadImage(StringView path) const;
+
+		/// @brief テクスチャを読み込む
+		/// @param path 論理パス
+		/// @param desc テクスチャの設定
+		/// @return テクスチャ 読めなければ空
+		Texture loadTexture(StringView path, TextureDesc desc = TextureDesc::Unmipped) const;
+
+		/// @brief テクスチャアセットとして登録する パックなら、読み込むときにパックの中身をデコードする
+		/// @param name アセット名
+		/// @param path 論理パス
+		/// @param desc テクスチャの設定
+		void registerTexture(AssetNameView name, StringView path, TextureDesc desc = TextureDesc::Unmipped) const;
+	};
+}
@@ -0,0 +1,139 @@
+﻿# include "AudioQueue.hpp"
+
+namespace UFOCat::Util
+{
+	AudioQueue::Pending *AudioQueue::m_submit(AssetNameView name)
+	{
+		// 何も BGM を流していないときの `bgmName` などは空なので無視する
+		if (name.isEmpty())
+		{
+			return nullptr;
+		}
+
+		++m_stats.submitted;
+		return &m_pending[AssetName{ name }];
+	}
+
+	void AudioQueue::play(AssetNameView name)
+	{
+		if (auto *pending = m_submit(name))
+		{
+			pending->transport = Transport::Play;
+		}
+	}
+
+	void AudioQueue::stop(AssetNameView name)
+	{
+		if (auto *pending = m_submit(name))
+		{
+			// 止めるならフェードは意味がない
+			pending->transport = Transport::Stop;
+			pending->fade.reset();
+		}
+	}
+
+	void AudioQueue::fadeVolume(AssetNameView name, double volume, const Duration &time)
+	{
+		if (auto *pending = m_submit(name))
+		{
+			pending->fade = Fade{ volume, time };
+		}
+	}
+
+	void AudioQueue::playOneShot(AssetNameView name)
+	{
+		if (auto *pending = m_submit(name))
+		{
+			pending->isOneShot = true;
+		}
+	}
+
+	void AudioQueue::prebuffer(AssetNameView name) const
+	{
+		if ((not name.isEmpty()) and (not AudioAsset::IsReady(name)))
+		{
+			AudioAsset::LoadAsync(name);
+		}
+	}
+
+	void AudioQueue::flush()
+	{
+		for (auto &&[name, pending] : m_pending)
+		{
+			auto active = m_active.find(name);
+
+			if (pending.transport == Transport::Play)
+			{
+				// 再生中なら何もしない 最後まで再生し終わっていたら、元の `play()` と同じく頭からもう一度再生する
+				if ((active == m_active.end()) or (not active->second.audio.isPlaying()))
+				{
+					if (active == m_active.end())
+					{
+						active = m_active.emplace(name, Active{ AudioAsset(name), none }).first;
+					}
+
+					active->second.audio.play();
+					++m_stats.issued;
+				}
+			}
+			else if ((pending.transport == Transport::Stop) and (active != m_active.end()))
+			{
+				active->second.audio.stop();
+				++m_stats.issued;
+				m_active.erase(active);
+				active = m_active.end();
+			}
+			else if ((pending.transport == Transport::Stop) and AudioAsset::IsReady(name))
+			{
+				// ボタンなど、このキューを通さずに再生されたものも止める
+				if (Audio audio = AudioAsset(name);
+					audio.isPlaying())
+				{
+					audio.stop();
+					++m_stats.issued;
+				}
+			}
+
+			if (pending.fade)
+			{
+				if (active == m_active.end())
+				{
+					active = m_active.emplace(name, Active{ AudioAsset(name), none }).first;
+				}
+
+				if (active->second.fadeVolume != pending.fade->volume)
+				{
+					active->second.audio.fadeVolume(pending.fade->volume, pending.fade->time);
+					active->second.fadeVolume = pending.fade->volume;
+					++m_stats.issued;
+				}
+			}
+
+			if (pending.isOneShot)
+			{
+				AudioAsset(name).playOneShot();
+				++m_stats.issued;
+			}
+		}
+
+		m_pending.clear();
+
+		// 止まった音は持っておく必要がないので手放す（効果音のキャッシュが解放できるように）
+		for (auto it = m_active.begin(); it != m_active.end();)
+		{
+			if (it->second.audio.isPlaying())
+			{
+				++it;
+			}
+			else
+			{
+				m_active.erase(it++);
+			}
+		}
+	}
+
+	const AudioQueue::Stats &AudioQueue::stats() const noexcept
+	{
+		return m_stats;
+	}
+}
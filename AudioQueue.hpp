@@ -0,0 +1,108 @@
+﻿# pragma once
+
+namespace UFOCat::Util
+{
+	/// @brief シーンからの音の操作（再生・停止・フェード・ワンショット再生）をためておき、フレームの終わりにまとめて実行するキュー @n
+	/// 同じフレームに同じ音へ出された操作は最後のものだけを残し、すでに再生中の音の再生など状態が変わらない操作は実行しない
+	/// @note 毎フレーム `play()` を呼んでも、アセットを名前で引くのも再生の命令を出すのも状態が変わるときだけになる
+	class AudioQueue
+	{
+	public:
+		/// @brief 実行した操作の数の記録
+		struct Stats
+		{
+			/// @brief シーンから出された操作の数
+			size_t submitted = 0;
+
+			/// @brief 実際にオーディオに対して実行した操作の数
+			size_t issued = 0;
+		};
+
+	private:
+		/// @brief 再生・停止の操作
+		enum class Transport : uint8
+		{
+			Play,
+			Stop,
+		};
+
+		/// @brief 音量のフェードの操作
+		struct Fade
+		{
+			/// @brief 目標の音量
+			double volume;
+
+			/// @brief フェードにかける時間
+			Duration time;
+		};
+
+		/// @brief 1フレームの間に1つの音へ出された操作をまとめたもの
+		struct Pending
+		{
+			/// @brief 最後に出された再生・停止の操作
+			Optional<Transport> transport;
+
+			/// @brief 最後に出されたフェードの操作
+			Optional<Fade> fade;
+
+			/// @brief ワンショット再生するかどうか 同じフレームに何度出されても1回だけ鳴らす
+			bool isOneShot = false;
+		};
+
+		/// @brief 再生中の音
+		struct Active
+		{
+			/// @brief オーディオ 毎回アセットを名前で引かずに済むように持っておく
+			Audio audio;
+
+			/// @brief 最後にフェードさせた目標の音量
+			Optional<double> fadeVolume;
+		};
+
+		/// @brief このフレームに出された操作 アセット名ごとにまとめる
+		HashTable<AssetName, Pending> m_pending;
+
+		/// @brief このキューから再生して、まだ止まっていない音
+		HashTable<AssetName, Active> m_active;
+
+		/// @brief 実行した操作の数の記録
+		Stats m_stats;
+
+		/// @brief アセット名に対応する、このフレームの操作を取得する
+		/// @param name アセット名
+		/// @return このフレームの操作 名前が空なら `none`
+		Pending *m_submit(AssetNameView name);
+
+	public:
+		/// @brief 再生する すでに再生中なら何もしない
+		/// @param name アセット名
+		void play(AssetNameView name);
+
+		/// @brief 停止する 再生していなければ何もしない
+		/// @param name アセット名
+		void stop(AssetNameView name);
+
+		/// @brief 音量をフェードさせる 同じ音量へのフェード中なら何もしない
+		/// @param name アセット名
+		/// @param volume 目標の音量
+		/// @param time フェードにかける時間
+		void fadeVolume(AssetNameView name, double volume, const Duration &time);
+
+		/// @brief ワンショット再生する
+		/// @param name アセット名
+		void playOneShot(AssetNameView name);
+
+		/// @brief すぐに再生できるように、非同期で読み込んでおく @n
+		/// ストリーミング再生の BGM なら、ファイルを開いて最初のバッファを埋めるところまで済ませておける
+		/// @param name アセット名
+		void prebuffer(AssetNameView name) const;
+
+		/// @brief ためておいた操作を実行する @n
+		/// シーンの更新の後に毎フレーム 1度 呼び出す
+		void flush();
+
+		/// @brief 実行した操作の数の記録を取得する
+		/// @return 記録
+		const Stats &stats() const noexcept;
+	};
+}
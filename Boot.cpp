@@ -0,0 +1,169 @@
+﻿# include "Boot.hpp"
+
+namespace UFOCat
+{
+	Boot::Boot(const InitData &init)
+		: IScene{ init }
+	{
+		// 猫の画像はファイル名を ID として登録だけしておき、テクスチャは使うときに読み込む
+		// パックはメモリマップを共有しているだけなので、コピーしてワーカースレッドに渡す
+		m_catalog = Async([assets = getData().assets]()
+		{
+			Catalog catalog{ LoadCatData().map([](const auto &data) { return std::make_shared<CatData>(data); }), Util::CatTextureResidency{} };
+			catalog.textures.scan(assets, U"texture/cat");
+			return catalog;
+		});
+
+		m_levels = Async([]() { return LoadLevelData(); });
+
+		m_backgrounds = Async([assets = getData().assets]() { return LoadBackgrounds(assets); });
+
+		// タイトルのボタンの効果音は、読み込んでいる間にデコードしておく
+		getData().soundEffects.preload({ Util::AudioSource::SE::Open, Util::AudioSource::SE::OK, Util::AudioSource::SE::Cancel });
+
+		// 猫の鳴き声は、デコードだけワーカースレッドで済ませておき、ボイスのオーディオは揃ってから作る
+		// 効果音の登録は起動前に終わっているので、キャッシュは参照で渡してよい
+		if (getData().catVoices.isEmpty())
+		{
+			m_catVoices = Async([&soundEffects = getData().soundEffects]()
+			{
+				CatVoices voices{ { Util::AudioSource::SE::Cat01, Util::AudioSource::SE::Cat02, Util::AudioSource::SE::CatAngry }, {} };
+				voices.waves = voices.names.map([&soundEffects](const AssetName &name) { return soundEffects.decode(name); });
+				return voices;
+			});
+		}
+		else
+		{
+			++m_completedCount;
+		}
+
+		// 前回までに使った文字と、よく使う文字のグリフを読み込んでいる間に作る
+		Util::GlyphCache::AddBasic();
+		Util::GlyphCache::Load();
+
+		for (const auto &title : Score::Titles)
+		{
+			Util::GlyphCache::Add(title.kanjiName);
+			Util::GlyphCache::Add(title.ruby);
+		}
+
+		m_progressBar.set(SizeF{ 0.5 * Scene::Width(), 14 }, Util::Palette::Brown)
+					 .setPositionAt(Scene::Center() + Vec2{ 0, 40 });
+	}
+
+	void Boot::m_collect()
+	{
+		// get() は、ワーカースレッドで投げられた例外をここで投げ直す
+		if (m_catalog.isReady())
+		{
+			auto &&catalog = m_catalog.get();
+			getData().cats = std::move(catalog.cats);
+			getData().catTextures = std::move(catalog.textures);
+			++m_completedCount;
+
+			// 手配書に出す猫種や毛色、模様の名前もグリフを作っておく
+			for (const auto &cat : getData().cats)
+			{
+				Util::GlyphCache::Add(cat->breed);
+				Util::GlyphCache::Add(cat->pattern);
+
+				for (const auto &[name, color] : cat->colors)
+				{
+					Util::GlyphCache::Add(name);
+				}
+			}
+
+			m_hasCatalogGlyphs = true;
+
+			// 猫のデータが揃ったら、それを使うものを作り始める
+			m_catDerived = Async([cats = getData().cats, textures = getData().catTextures]()
+			{
+				return CatDerived{ SimilarityMatrix{ cats }, LoadHitMasks(cats, textures) };
+			});
+		}
+
+		if (m_catDerived.isReady())
+		{
+			auto &&derived = m_catDerived.get();
+			getData().similarities = std::move(derived.similarities);
+			getData().hitMasks = std::move(derived.hitMasks);
+			++m_completedCount;
+		}
+
+		if (m_levels.isReady())
+		{
+			getData().levels = m_levels.get();
+
+			// ファイルの監視はメインスレッドで始める
+			getData().levelWatcher = LevelDataWatcher{ U"level_data.json" };
+
+			// 最大レベル数の情報をスコアデータに共通のものとして設定しておく
+			Score::Generic::ByLevel::SetLevelCount(getData().levels.size());
+			++m_completedCount;
+		}
+
+		if (m_backgrounds.isReady())
+		{
+			getData().backgrounds = m_backgrounds.get();
+			++m_completedCount;
+		}
+
+		if (m_catVoices.isReady())
+		{
+			auto &&voices = m_catVoices.get();
+			getData().catVoices.load(voices.names, voices.waves);
+
+			// ボイスの分は効果音のキャッシュとは別に持ち続けるので、その分だけ効果音の予算を減らす
+			getData().soundEffects.setBudget(Util::SoundEffectCache::DefaultBudget - Min(Util::SoundEffectCache::DefaultBudget, getData().catVoices.residentBytes()));
+			++m_completedCount;
+		}
+	}
+
+	void Boot::m_prewarmGlyphs()
+	{
+		if (m_hasPrewarmedGlyphs)
+		{
+			return;
+		}
+
+		// 猫のデータの文字列が揃うまでは、終わったことにしない
+		if ((Util::GlyphCache::Prewarm(m_GlyphBudget) == 0) and m_hasCatalogGlyphs)
+		{
+			m_hasPrewarmedGlyphs = true;
+			++m_completedCount;
+		}
+	}
+
+	void Boot::update()
+	{
+		// 遷移中に何度も changeScene しないように、全部終わったら何もしない
+		if (m_completedCount == m_TaskCount)
+		{
+			return;
+		}
+
+		m_collect();
+		m_prewarmGlyphs();
+
+		m_progressBar.setProgress(static_cast<double>(m_completedCount) / m_TaskCount);
+
+		if (m_completedCount == m_TaskCount)
+		{
+# if _DEBUG
+			Logger << U"[Boot] All data loaded in {:.1f}ms."_fmt(m_stopwatch.msF());
+# endif
+			changeScene(State::Title, 0.5s);
+		}
+	}
+
+	void Boot::draw() const
+	{
+		Scene::Rect().draw(Util::Palette::LightBrownAlt);
+		DrawPolkaDotBackground(30, 0.3, Util::Palette::LightBrown);
+
+		FontAsset(Util::FontFamily::YuseiMagic)(U"よみこみ中{}"_fmt(String(static_cast<size_t>(Scene::Time() * 3) % 4, U'.')))
+			.drawAt(36, Scene::Center() - Vec2{ 0, 20 }, Util::Palette::Brown);
+
+		m_progressBar.draw();
+	}
+}
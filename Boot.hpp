@@ -0,0 +1,85 @@
+﻿# pragma once
+# include "Common.hpp"
+
+namespace UFOCat
+{
+	/// @brief 起動時に、ゲーム全体で共有するデータをワーカースレッドで並列に読み込むシーン @n
+	/// 読み込みの間は進捗を表示し、`GameData` が揃ったらタイトルに移る
+	class Boot : public App::Scene
+	{
+	private:
+		/// @brief 猫のデータと、画像ファイルを登録したテクスチャ管理
+		struct Catalog
+		{
+			Array<std::shared_ptr<CatData>> cats;
+
+			Util::CatTextureResidency textures;
+		};
+
+		/// @brief 猫のデータが揃ってから作るもの
+		struct CatDerived
+		{
+			SimilarityMatrix similarities;
+
+			Array<std::shared_ptr<const AlphaMask>> hitMasks;
+		};
+
+		/// @brief 猫の鳴き声の効果音の、デコードした波形
+		struct CatVoices
+		{
+			Array<AssetName> names;
+
+			Array<Wave> waves;
+		};
+
+		/// @brief 読み込み処理の数
+		constexpr static size_t m_TaskCount = 6;
+
+		/// @brief 猫のデータの読み込み
+		AsyncTask<Catalog> m_catalog;
+
+		/// @brief 類似度の表と当たり判定マスクの作成 `m_catalog` が終わってから始める
+		AsyncTask<CatDerived> m_catDerived;
+
+		/// @brief レベルデータの読み込み
+		AsyncTask<Array<LevelData>> m_levels;
+
+		/// @brief 背景画像の影の色の計算
+		AsyncTask<Array<Util::BackgroundData>> m_backgrounds;
+
+		/// @brief 猫の鳴き声のデコード オーディオはメインスレッドで作る
+		AsyncTask<CatVoices> m_catVoices;
+
+		/// @brief 猫のデータの文字列をグリフを作る文字に追加したかどうか
+		bool m_hasCatalogGlyphs = false;
+
+		/// @brief グリフを作り終えたかどうか
+		bool m_hasPrewarmedGlyphs = false;
+
+		/// @brief 1フレームでグリフを作るのに使ってよい時間 読み込み画面のアニメーションが止まらない程度にする
+		constexpr static Duration m_GlyphBudget = 0.008s;
+
+		/// @brief 終わった読み込み処理の数
+		size_t m_completedCount = 0;
+
+		/// @brief 読み込みにかかった時間の計測
+		s3d::Stopwatch m_stopwatch{ StartImmediately::Yes };
+
+		/// @brief 読み込みの進捗を表示するバー
+		GUI::ProgressBar m_progressBar;
+
+		/// @brief 終わった処理の結果を `GameData` に移し、次の処理を始める
+		void m_collect();
+
+		/// @brief ゲームで使う文字のグリフを、予算の時間だけ作る
+		void m_prewarmGlyphs();
+
+	public:
+		/// @brief 依存関係のない読み込み処理を全て始める
+		Boot(const InitData &init);
+
+		void update() override;
+
+		void draw() const override;
+	};
+}
@@ -1,8 +1,9 @@
 ﻿# include "GUI.hpp"
+# include "TextMeasure.hpp"
 
 namespace UFOCat::GUI
 {
-	Button::Button(const Font &font, double fontSize, const String &text, const Audio &se, PositionType positionType, bool isEnabled, const Vec2 &padding)
+	Button::Button(const Font &font, double fontSize, const String &text, AssetNameView se, PositionType positionType, bool isEnabled, const Vec2 &padding)
 		: m_font(font)
 		, m_fontSize(fontSize)
 		, m_text(text)
@@ -13,34 +14,63 @@ namespace UFOCat::GUI
 		m_positionType = positionType;
 
 		// フォントの描画領域 (左上(0, 0)の位置) を特定して、パディング分を足したサイズで Rect を作成
-		m_region = RectF{ m_font(m_text).region(fontSize).size + m_padding };
+		m_layout();
 	}
 
-	Button::Button(double fontSize, const String &text, const Audio &se, PositionType positionType, bool isEnabled, const Vec2 &padding)
+	Button::Button(double fontSize, const String &text, AssetNameView se, PositionType positionType, bool isEnabled, const Vec2 &padding)
 		// ここでフォントを決め打ちにする
 		: Button(FontAsset(Util::FontFamily::YuseiMagic), fontSize, text, se, positionType, isEnabled, padding)
 	{}
 
 	Button::Button(const Font &font, double fontSize, const String &text, PositionType positionType, bool isEnabled, const Vec2 &padding)
 		// ここで SE を決め打ちにする
-		: Button(font, fontSize, text, AudioAsset(Util::AudioSource::SE::Open), positionType, isEnabled, padding)
+		: Button(font, fontSize, text, Util::AudioSource::SE::Open, positionType, isEnabled, padding)
 	{}
 
-	Button& Button::set(const Font &font, double fontSize, const String &text, const Audio &se, PositionType positionType, bool isEnabled, const Vec2 &padding)
+	void Button::m_layout()
 	{
-		m_font = font;
+		// 同じテキストのボタンを作りなおしたときなどは、計測済みの大きさを使う
+		m_region.setSize(Util::TextMeasure::Region(m_font, m_text, m_fontSize) + m_padding);
+		LayoutCounter::Add();
+	}
+
+	Button& Button::set(const Font &font, double fontSize, const String &text, AssetNameView se, PositionType positionType, bool isEnabled, const Vec2 &padding)
+	{
+		// 毎フレーム同じ値で呼ばれても、大きさに関わる値が変わっていなければ計測しなおさない
+		const bool isDirty = (m_font.id() != font.id())
+			or (m_fontSize != fontSize)
+			or (m_text != text)
+			or (m_padding != padding);
+
+		if (m_font.id() != font.id())
+		{
+			m_font = font;
+		}
+
+		if (m_se != se)
+		{
+			m_se = AssetName{ se };
+		}
+
+		if (m_text != text)
+		{
+			m_text = text;
+		}
+
 		m_fontSize = fontSize;
-		m_text = text;
-		m_se = se;
 		m_positionType = positionType;
 		m_isEnabled = isEnabled;
 		m_padding = padding;
-		m_region = RectF{ m_font(m_text).region(fontSize).size + m_padding };
+
+		if (isDirty)
+		{
+			m_layout();
+		}
 
 		return *this;
 	}
 
-	Button &Button::set(double fontSize, const String &text, const Audio &se, PositionType positionType, bool isEnabled, const Vec2 &padding)
+	Button &Button::set(double fontSize, const String &text, AssetNameView se, PositionType positionType, bool isEnabled, const Vec2 &padding)
 	{
 		return set(m_font, fontSize, text, se, positionType, isEnabled, padding);
 	}
@@ -57,19 +87,31 @@ namespace UFOCat::GUI
 
 	Button &Button::setFont(const Font &font)
 	{
-		m_font = font;
+		if (m_font.id() != font.id())
+		{
+			m_font = font;
 
-		// フォントを変えたら描画領域も更新する
-		m_region = RectF{ m_font(m_text).region(m_fontSize).size + m_padding };
+			// フォントを変えたら描画領域も更新する
+			m_layout();
+		}
 		return *this;
 	}
 
 	Button& Button::setText(const String &text)
 	{
-		m_text = text;
+		if (m_text != text)
+		{
+			m_text = text;
 
-		// テキストを変えたら描画領域も更新する
-		m_region = RectF{ m_font(m_text).region(m_fontSize).size + m_padding };
+			// テキストを変えたら描画領域も更新する
+			m_layout();
+		}
+		return *this;
+	}
+
+	Button &Button::setEnabled(bool isEnabled) noexcept
+	{
+		m_isEnabled = isEnabled;
 		return *this;
 	}
 
@@ -85,7 +127,7 @@ namespace UFOCat::GUI
 		// ボタンが押されたらSEを鳴らして true を返す
 		if (m_isEnabled and m_region.leftClicked())
 		{
-			m_se.playOneShot();
+			AudioAsset(m_se).playOneShot();
 			return true;
 		}
 		else
@@ -1,46 +1,31 @@
 ﻿# include "CatData.hpp"
+# include <bit>
 
 namespace UFOCat::Core
 {
 	uint32 CatData::getSameDataCount(const CatData& target) const
 	{
-		uint32 count = 0;
-
-		if (breed == target.breed)
-		{
-			++count;
-		}
-
-		if (pattern == target.pattern)
-		{
-			++count;
-		}
-		// トラ と タビー、ミケ と キャリコ はほぼ同義なので、「等しい」ものとしてカウントする
-		else if ((pattern == U"トラ" and target.pattern == U"タビー")
-			or (pattern == U"タビー" and target.pattern == U"トラ"))
-		{
-			++count;
-		}
-		else if ((pattern == U"三毛" and target.pattern == U"キャリコ")
-			or (pattern == U"キャリコ" and target.pattern == U"三毛"))
-		{
-			++count;
-		}
+		// 同義の模様は同じ ID になっているので、ID の比較だけで「等しい」ものとしてカウントされる
+		// 毛色は両方が持っている色のビットの数を数える
+		return static_cast<uint32>(breedId == target.breedId)
+			+ static_cast<uint32>(patternId == target.patternId)
+			+ static_cast<uint32>(isLongHair == target.isLongHair)
+			+ static_cast<uint32>(std::popcount(colorMask & target.colorMask));
+	}
 
-		if (isLongHair == target.isLongHair)
+	StringView CatData::GetPatternClass(StringView pattern)
+	{
+		// トラ と タビー、ミケ と キャリコ はほぼ同義なので、「等しい」ものとして扱う
+		if (pattern == U"タビー")
 		{
-			++count;
+			return U"トラ";
 		}
-
-		for (const auto& [name, color] : colors)
+		else if (pattern == U"キャリコ")
 		{
-			if (target.colors.contains(name))
-			{
-				++count;
-			}
+			return U"三毛";
 		}
 
-		return count;
+		return pattern;
 	}
 
 	bool CatData::operator==(const CatData& target) const
@@ -5,15 +5,30 @@ namespace UFOCat::Core
 	/// @brief UFO猫のデータ（品種や模様など）
 	struct CatData
 	{
-		// ID（使わんかも）
+		// カタログ上の ID（テクスチャのファイル名と同じ）
 		size_t id;
 
+		/// @brief テクスチャ（と当たり判定マスク）に使う画像の ID @n
+		/// 普通は `id` と同じで、`cat_data.json` で `base` が指定されていれば、その ID の画像を色付けして使う
+		size_t textureId = 0;
+
+		/// @brief ベース画像を毛色で色付けして描画するかどうか
+		bool isRecolored = false;
+
+		/// @brief `GameData::cats` の中でのインデックス（`LoadCatData()` で割り振る） @n
+		/// 類似度の表や当たり判定マスクはこの値で引く
+		size_t index = 0;
+
 		// 品種
 		String breed;
 
 		// 色 複数あればその全て
 		HashTable<String, Color> colors;
 
+		/// @brief 色を `cat_data.json` に書かれた順に並べたもの @n
+		/// 色付けして描画する猫では、色マスクの R, G, B の領域をこの順に塗る
+		Array<Color> regionColors;
+
 		// 模様の種類
 		String pattern;
 
@@ -21,6 +36,15 @@ namespace UFOCat::Core
 		// 表示はしないけど、類似条件のためのデータとして使う
 		bool isLongHair;
 
+		/// @brief 品種を整数に置き換えた ID（`LoadCatData()` で割り振る）
+		uint16 breedId = 0;
+
+		/// @brief 模様を、同義のもの（トラ と タビー など）をまとめたうえで整数に置き換えた ID（`LoadCatData()` で割り振る）
+		uint16 patternId = 0;
+
+		/// @brief 持っている毛色を、色の名前ごとに割り振った番号のビットで表したもの（`LoadCatData()` で割り振る）
+		uint64 colorMask = 0;
+
 		/// @brief デフォルトコンストラクタ
 		CatData() = default;
 
@@ -32,6 +56,7 @@ namespace UFOCat::Core
 		/// @param isLongHair 長毛か
 		CatData(size_t id, String breed, HashTable<String, Color> colors, String pattern, bool isLongHair)
 			: id{ id }
+			, textureId{ id }
 			, breed{ breed }
 			, colors{ colors }
 			, pattern{ pattern }
@@ -39,8 +64,17 @@ namespace UFOCat::Core
 		{
 		}
 
+		/// @brief 特徴（品種、模様、長毛か、各毛色）のうち、一致しているものの数を数える
+		/// @param target 比較対象
+		/// @return 一致している特徴の数
+		/// @note 整数の ID とビットマスクを比べるだけなので、文字列の比較は行わない
 		uint32 getSameDataCount(const CatData& target) const;
 
+		/// @brief 模様の名前を、同義の模様をまとめた代表の名前に置き換える
+		/// @param pattern 模様の名前
+		/// @return 代表の名前 トラ と タビー、ミケ と キャリコ はほぼ同義なので、それぞれ同じ名前になる
+		static StringView GetPatternClass(StringView pattern);
+
 		/// @brief データが等しいかどうか id の比較で比べる
 		/// @param target 比較対象
 		/// @return 等しいデータなら true
@@ -46,6 +46,22 @@ namespace UFOCat::Core
 		return m_hitArea;
 	}
 
+	Vec2 CatObject::getPositionAt(double progress) const
+	{
+		// 1フレームで自分の横幅以上動いていたら、移動ではなくワープ（出現位置の変更など）とみなして補間しない
+		if (m_prevPosition.distanceFromSq(position) > (m_ClientSize.x * m_ClientSize.x))
+		{
+			return position;
+		}
+
+		return m_prevPosition.lerp(position, Clamp(progress, 0.0, 1.0));
+	}
+
+	RectF CatObject::getBoundingRect(double progress) const
+	{
+		return RectF{ getPositionAt(progress), m_ClientSize };
+	}
+
 	const CatData &CatObject::getCatData(CatData* out) const
 	{
 		// 出力先変数の指定があった時のみオブジェクトをコピーして返す
@@ -65,20 +81,54 @@ namespace UFOCat::Core
 
 	CatObject &CatObject::setRandomVelocity(size_t level)
 	{
-		// マジックナンバーだらけだけど仕様書に書いてあるとおり
-		double min = 65.0 * (1.0 + level / 10.0) + (10 * level);
-		double max = 90.0 + (1.0 + Random(1.0, static_cast<double>(level)) / 100.0) * Max(Scene::Width(), Scene::Height()) * ((1 / (0.9 * (level / 10.0 + 0.9))) * Math::Pow(level / 10.0 - 1 + 0.9, 4 * (level / 10.0 - 1 + 0.9)) * Math::Log(Math::Pow(level / 10.0 + 0.9, 2)));
-		velocity = RandomVec2(Random(min, max));
+		velocity = RandomVelocity(level, VelocityFactor(level), Scene::Size(), GetDefaultRNG());
+		return *this;
+	}
+
+	CatObject &CatObject::setSeed(uint64 seed) noexcept
+	{
+		m_rng.seed(seed);
+
+		// 同じシード値なら同じ位置から出てくるように、最初の出現位置も新しい乱数で決めなおす
+		m_changeScreenEdgePosition();
+		m_prevPosition = position;
+		m_updateHitArea();
 
 		return *this;
 	}
 
+	double CatObject::VelocityFactor(size_t level)
+	{
+		// マジックナンバーだらけだけど仕様書に書いてあるとおり
+		return (1 / (0.9 * (level / 10.0 + 0.9))) * Math::Pow(level / 10.0 - 1 + 0.9, 4 * (level / 10.0 - 1 + 0.9)) * Math::Log(Math::Pow(level / 10.0 + 0.9, 2));
+	}
+
+	Vec2 CatObject::RandomVelocity(size_t level, double factor, const Size &sceneSize, DefaultRNG &rng)
+	{
+		const double min = 65.0 * (1.0 + level / 10.0) + (10 * level);
+		const double max = 90.0 + (1.0 + Random(1.0, static_cast<double>(level), rng) / 100.0) * Max(sceneSize.x, sceneSize.y) * factor;
+
+		return RandomVec2(Random(min, max, rng), rng);
+	}
+
 	CatObject &CatObject::setCatData(const CatData &data)
 	{
 		m_catData = data;
 		return *this;
 	}
 
+	CatObject &CatObject::setRecolor(const Optional<CatRecolor> &recolor)
+	{
+		m_recolor = recolor;
+		return *this;
+	}
+
+	CatObject &CatObject::setHitMask(const std::shared_ptr<const AlphaMask> &mask)
+	{
+		m_hitMask = mask;
+		return *this;
+	}
+
 	CatObject &CatObject::setAction(const LevelData::ActionData &actionData)
 	{
 		m_actionData = actionData;
@@ -244,7 +294,7 @@ namespace UFOCat::Core
 				m_stopwatch.setTimeout([&]()
 				{
 					// 位置をランダムに変更
-					position = RandomVec2(range);
+					position = RandomVec2(range, m_rng);
 
 					// フェードインに移行する
 					m_appearanceState = AppearanceState::In;
@@ -387,7 +437,7 @@ namespace UFOCat::Core
 						// overflow の 1 が右
 						// overflow の 2 が下
 						// overflow の 3 が左 に対応（時計回り）
-						m_edgeDirection = ToEnum<ScreenEdgeDirection>(Random(0, 3));
+						m_edgeDirection = ToEnum<ScreenEdgeDirection>(Random(0, 3, m_rng));
 					}
 					while (overflow[FromEnum(m_edgeDirection)] == 0);
 
@@ -398,7 +448,7 @@ namespace UFOCat::Core
 						// 上：y だけ領域外
 						case ScreenEdgeDirection::Top:
 						{
-							x = Random(0, getMaxDisplayedArea().w);
+							x = Random(0, getMaxDisplayedArea().w, m_rng);
 							y = -(m_ClientSize * m_shadowScale).y;
 						}
 						break;
@@ -407,14 +457,14 @@ namespace UFOCat::Core
 						case ScreenEdgeDirection::Right:
 						{
 							x = Scene::Width() + (m_ClientSize * Math::AbsDiff(1.0, m_shadowScale)).x;
-							y = Random(0, getMaxDisplayedArea().h);
+							y = Random(0, getMaxDisplayedArea().h, m_rng);
 						}
 						break;
 
 						// 下：y だけ領域外
 						case ScreenEdgeDirection::Bottom:
 						{
-							x = Random(0, getMaxDisplayedArea().w);
+							x = Random(0, getMaxDisplayedArea().w, m_rng);
 							y = Scene::Height() + (m_ClientSize * Math::AbsDiff(1.0, m_shadowScale)).y;
 						}
 						break;
@@ -423,7 +473,7 @@ namespace UFOCat::Core
 						case ScreenEdgeDirection::Left:
 						{
 							x = -(m_ClientSize * m_shadowScale).x;
-							y = Random(0, getMaxDisplayedArea().h);
+							y = Random(0, getMaxDisplayedArea().h, m_rng);
 						}
 						break;
 
@@ -566,17 +616,33 @@ namespace UFOCat::Core
 
 	CatObject &CatObject::act()
 	{
+		// 動かす前の位置を、クリック時刻での位置の補間用に残しておく
+		m_prevPosition = position;
+		m_prevAppearanceState = m_appearanceState;
+
 		// m_actionData.params (variant の型)に格納されている引数をもとにアクションを呼び出す
-		return std::visit(InvokeAction{ *this }, m_actionData.params);
+		std::visit(InvokeAction{ *this }, m_actionData.params);
+
+		// 動かし終わったら、そのフレームの位置に当たり判定を合わせておく
+		m_updateHitArea();
+
+		return *this;
 	}
 
 	CatObject &CatObject::draw()
 	{
-		// 描画前の共通処理として、当たり判定を更新
-		m_hitArea.setPos(x + m_ClientSize.x / 2, y + m_ClientSize.y / 2);
-
 		// 描画範囲をクリップ -> スケール変更 -> 任意位置にアルファ値を乗算して描画
-		m_Texture(m_ClipArea).scaled(m_Scale).draw(position, ColorF{ 1.0, m_textureAlpha });
+		const auto &region = m_Texture(m_ClipArea).scaled(m_Scale);
+
+		// 色付けする猫なら毛色で塗り分ける
+		if (m_recolor)
+		{
+			m_recolor->draw(region, position, ColorF{ 1.0, m_textureAlpha });
+		}
+		else
+		{
+			region.draw(position, ColorF{ 1.0, m_textureAlpha });
+		}
 		return *this;
 	}
 
@@ -635,10 +701,26 @@ namespace UFOCat::Core
 		}
 	}
 
-	bool CatObject::checkCatchable(const CatData &target, bool* const isCorrect) const
+	bool CatObject::hasJustAppeared() const noexcept
+	{
+		return (m_prevAppearanceState == AppearanceState::Hidden) and (m_appearanceState != AppearanceState::Hidden);
+	}
+
+	bool CatObject::checkCatchable(const Vec2 &point, const CatData &target, bool* const isCorrect, double progress) const
 	{
 		*isCorrect = m_catData == target;
-		return m_hitArea.leftClicked();
+
+		// クリックされた時点での位置と今の位置のずれ
+		const Vec2 offset = position - getPositionAt(progress);
+
+		// マスクがあれば、描画されている不透明な部分だけを当たりにする
+		if (m_hitMask)
+		{
+			return m_hitMask->test(point + offset - position);
+		}
+
+		// 楕円は今の位置にあるので、クリック位置の方をずらして判定する
+		return m_hitArea.intersects(point + offset);
 	}
 
 	CatObject CatObject::clone() const
@@ -646,39 +728,50 @@ namespace UFOCat::Core
 		return CatObject{ *this };
 	}
 
+	Image CatObject::ToClientImage(const Image &source)
+	{
+		// draw() と同じく クリップ -> スケール変更
+		return source.clipped(m_ClipArea).scaled(m_Scale, InterpolationAlgorithm::Area);
+	}
+
+	std::shared_ptr<const AlphaMask> CatObject::CreateHitMask(const Image &source)
+	{
+		return std::make_shared<const AlphaMask>(ToClientImage(source));
+	}
+
 	std::tuple<Vec2, Vec2> CatObject::m_changeScreenEdgePosition()
 	{
 		Vec2 start{}, goal{};
 
 		// ランダムに開始位置を決める
-		switch (m_edgeDirection = ToEnum<ScreenEdgeDirection>(Random(0, 3)))
+		switch (m_edgeDirection = ToEnum<ScreenEdgeDirection>(Random(0, 3, m_rng)))
 		{
 			// 上側なら下側を目指す
 		case ScreenEdgeDirection::Top:
 		{
-			start = RandomVec2(m_screenEdgeArea.top());
-			goal = RandomVec2(m_screenEdgeArea.bottom());
+			start = RandomVec2(m_screenEdgeArea.top(), m_rng);
+			goal = RandomVec2(m_screenEdgeArea.bottom(), m_rng);
 		}
 		break;
 		// 右側なら左側を目指す
 		case ScreenEdgeDirection::Right:
 		{
-			start = RandomVec2(m_screenEdgeArea.right());
-			m_crossData.goal = RandomVec2(m_screenEdgeArea.left());
+			start = RandomVec2(m_screenEdgeArea.right(), m_rng);
+			m_crossData.goal = RandomVec2(m_screenEdgeArea.left(), m_rng);
 		}
 		break;
 		// 下側なら上側を目指す
 		case ScreenEdgeDirection::Bottom:
 		{
-			start = RandomVec2(m_screenEdgeArea.bottom());
-			goal = RandomVec2(m_screenEdgeArea.top());
+			start = RandomVec2(m_screenEdgeArea.bottom(), m_rng);
+			goal = RandomVec2(m_screenEdgeArea.top(), m_rng);
 		}
 		break;
 		// 左側なら右側を目指す
 		case ScreenEdgeDirection::Left:
 		{
-			start = RandomVec2(m_screenEdgeArea.left());
-			goal = RandomVec2(m_screenEdgeArea.right());
+			start = RandomVec2(m_screenEdgeArea.left(), m_rng);
+			goal = RandomVec2(m_screenEdgeArea.right(), m_rng);
 		}
 		break;
 		}
@@ -687,4 +780,9 @@ namespace UFOCat::Core
 
 		return std::tie(start, goal);
 	}
+
+	void CatObject::m_updateHitArea()
+	{
+		m_hitArea.setPos(x + m_ClientSize.x / 2, y + m_ClientSize.y / 2);
+	}
 }
@@ -2,6 +2,8 @@
 #include "CatData.hpp"
 #include "Stopwatch.hpp"
 #include "LevelData.hpp"
+#include "AlphaMask.hpp"
+#include "CatRecolor.hpp"
 
 /// @brief インゲームを動作させるためのコア機能群
 namespace UFOCat::Core
@@ -86,9 +88,17 @@ namespace UFOCat::Core
 
 	private:
 		/// @brief 当たり判定の領域
-		/// @note これもあくまで `m_ClientSize` を基準にしたときの当たり判定領域であって、表示スケールが変わった場合はこれも調整する必要がある
+		/// @note これもあくまで `m_ClientSize` を基準にしたときの当たり判定領域であって、表示スケールが変わった場合はこれも調整する必要がある @n
+		/// 位置は `act()` の最後に更新されるので、描画前でもそのフレームの位置で判定できる
 		Ellipse m_hitArea;
 
+		/// @brief 1フレーム前の `act()` 開始時点での位置 クリック時刻での位置を補間するのに使う
+		Vec2 m_prevPosition{ 0, 0 };
+
+		/// @brief ピクセル単位の当たり判定に使うマスク @n
+		/// 設定されていなければ `m_hitArea` の楕円で判定する
+		std::shared_ptr<const AlphaMask> m_hitMask = nullptr;
+
 		/// @brief UFO猫のデータ
 		CatData m_catData;
 
@@ -99,6 +109,13 @@ namespace UFOCat::Core
 		/// @brief このオブジェクトがどんな外見状態にあるか
 		AppearanceState m_appearanceState = AppearanceState::Hidden;
 
+		/// @brief 1フレーム前の `act()` 開始時点での外見状態 画面に出てきた瞬間を調べるのに使う
+		AppearanceState m_prevAppearanceState = AppearanceState::Hidden;
+
+		/// @brief アクション中の動き（出現位置など）に使う乱数生成器 @n
+		/// 猫ごとに持たせておき、レベルではスポーンするときに計画のシード値から決めた値で初期化する
+		SmallRNG m_rng{ RandomUint64() };
+
 		/// @brief このオブジェクトが画面端のどこから出現するかを表す
 		ScreenEdgeDirection m_edgeDirection = ScreenEdgeDirection::Top;
 
@@ -143,6 +160,10 @@ namespace UFOCat::Core
 		/// @brief 使用テクスチャ
 		const Texture m_Texture;
 
+		/// @brief テクスチャを毛色で色付けして描画する場合の情報
+		/// @note `none` ならテクスチャをそのまま描画する
+		Optional<CatRecolor> m_recolor;
+
 		/// @brief スクリーンでの表示サイズ
 		/// @note あくまでオブジェクトを湧かすときのサイズであって、それ以外の特別な用途では任意の倍率に拡大縮小してよい
 		const SizeF m_ClientSize;
@@ -193,6 +214,16 @@ namespace UFOCat::Core
 		/// @return 楕円オブジェクト
 		Ellipse getHitArea() const;
 
+		/// @brief 1フレーム前から今のフレームまでの間の、ある時点での位置を取得する
+		/// @param progress 1フレーム前を 0.0、今のフレームを 1.0 とした時点
+		/// @return 補間した位置 ワープするアクションなどで大きく動いていた場合は今の位置
+		Vec2 getPositionAt(double progress) const;
+
+		/// @brief このオブジェクトの表示領域（影を除く）を取得する
+		/// @param progress 1フレーム前を 0.0、今のフレームを 1.0 とした時点（デフォルト `1.0`）
+		/// @return 左上を `position`（`progress` を指定した場合は補間した位置）とした表示サイズの矩形
+		RectF getBoundingRect(double progress = 1.0) const;
+
 		/// @brief このUFO猫の情報を取得する @n
 		/// 出力先変数の指定が可能
 		/// @param out 出力先変数（デフォルト `nullptr`） 新しいオブジェクトが格納される
@@ -211,11 +242,42 @@ namespace UFOCat::Core
 		/// @return 自分自身の参照
 		CatObject &setRandomVelocity(size_t level);
 
+		/// @brief `RandomVelocity()` で使う、レベルだけで決まる係数を求める @n
+		/// 累乗や対数を含むので、同じレベルでたくさん速度を決めるときは1度だけ求めて使いまわす
+		/// @param level 整数値（1 ~ 10 の範囲で、特に現在のフェーズレベルを入れることを想定）
+		/// @return 係数
+		static double VelocityFactor(size_t level);
+
+		/// @brief 定式と引数の値に従ってランダムに速度を決める
+		/// @param level 整数値（1 ~ 10 の範囲で、特に現在のフェーズレベルを入れることを想定）
+		/// @param factor `VelocityFactor(level)` の値
+		/// @param sceneSize シーンの大きさ
+		/// @param rng 使う乱数生成器
+		/// @return 速度
+		/// @note シーンの大きさと乱数生成器を引数で受け取るので、ワーカースレッドからも呼び出せる
+		static Vec2 RandomVelocity(size_t level, double factor, const Size &sceneSize, DefaultRNG &rng);
+
+		/// @brief アクション中の動きに使う乱数生成器を初期化する @n
+		/// コンストラクタで決めた画面端の出現位置は初期化前の乱数によるものなので、ここで選びなおす
+		/// @param seed シード値
+		/// @return 自分自身の参照
+		CatObject &setSeed(uint64 seed) noexcept;
+
 		/// @brief UFO猫のデータを登録する
 		/// @param data データ
 		/// @return （変更を反映した）自分自身の参照
 		CatObject &setCatData(const CatData &data);
 
+		/// @brief ピクセル単位の当たり判定に使うマスクを登録する
+		/// @param mask `CreateHitMask()` で作ったマスク
+		/// @return 自分自身の参照
+		CatObject &setHitMask(const std::shared_ptr<const AlphaMask> &mask);
+
+		/// @brief テクスチャを毛色で色付けして描画するための情報を登録する
+		/// @param recolor 色付けの情報 `none` ならテクスチャをそのまま描画する
+		/// @return 自分自身の参照
+		CatObject &setRecolor(const Optional<CatRecolor> &recolor);
+
 		/// @brief UFO猫が行う動作（このクラスに定義された行動系メソッドのいずれかとそのオプション）を登録する
 		/// @param actionData アクションデータ
 		/// @return 自分自身の参照
@@ -237,6 +299,8 @@ namespace UFOCat::Core
 			, velocity{ { 0, 0 } }
 		{
 			m_changeScreenEdgePosition();
+			m_prevPosition = position;
+			m_updateHitArea();
 		}
 
 		/// @brief 使用テクスチャ、初期位置、初期速度からオブジェクトを作る
@@ -250,20 +314,28 @@ namespace UFOCat::Core
 			, m_screenEdgeArea{ -Vec2(m_ClientSize), Scene::Width() + m_ClientSize.x, Scene::Height() + m_ClientSize.y }
 			, position{ position }
 			, velocity{ velocity }
-		{ }
+			, m_prevPosition{ position }
+		{
+			m_updateHitArea();
+		}
 
 		/// @brief コピーコンストラクタ
 		/// @param obj コピー元のオブジェクト
 		/// @remarks すべてをコピーするわけではない
 		CatObject(const CatObject &obj)
 			: m_Texture{ obj.m_Texture }
+			, m_recolor{ obj.m_recolor }
 			, m_ClientSize{ obj.m_ClientSize }
 			, m_hitArea{ obj.m_hitArea }
+			, m_hitMask{ obj.m_hitMask }
 			, m_screenEdgeArea{ obj.m_screenEdgeArea }
 			, m_catData{ obj.m_catData }
+			, m_rng{ obj.m_rng }
+			, m_edgeDirection{ obj.m_edgeDirection }
 			, m_actionData{ obj.m_actionData }
 			, position{ obj.position }
 			, velocity{ obj.velocity }
+			, m_prevPosition{ obj.m_prevPosition }
 		{ }
 
 		/* -- メソッド -- */
@@ -413,16 +485,33 @@ namespace UFOCat::Core
 		/// @return めちゃくちゃ正確とは限らない、あくまで内部で設定されている外見状態に基づく
 		bool isVisible() const;
 
-		/// @brief オブジェクトがタッチされたときに、現在のターゲット情報と比較して捕まえられるか試す
+		/// @brief このフレームの `act()` で、画面外から画面内に出てきたかどうかを取得する
+		/// @return 出てきたなら `true`
+		bool hasJustAppeared() const noexcept;
+
+		/// @brief 指定した座標がクリックされたときに、現在のターゲット情報と比較して捕まえられるか試す
+		/// @param point クリックされた座標
 		/// @param target ターゲットの情報
 		/// @param isCorrect タッチしたオブジェクトがターゲットと同じかどうかを格納する出力先変数へのポインタ
-		/// @return タッチしたとき `true`
-		bool checkCatchable(const CatData &target, bool *const isCorrect) const;
+		/// @param progress クリックされた時点 1フレーム前を 0.0、今のフレームを 1.0 とする（デフォルト `1.0`）
+		/// @return 当たり判定の中をクリックしていたら `true`
+		/// @remarks マウスの状態は見ないので、クリックがあったかどうかは呼び出し側で確認しておく
+		bool checkCatchable(const Vec2 &point, const CatData &target, bool *const isCorrect, double progress = 1.0) const;
 
 		/// @brief このオブジェクトの複製を生成して返す
 		/// @return 情報がコピーされた新しいインスタンス
 		CatObject clone() const;
 
+		/// @brief テクスチャの元画像を、実際に描画される範囲と大きさ（クリップ -> スケール変更）に加工する
+		/// @param source テクスチャの元画像
+		/// @return 描画サイズの画像
+		static Image ToClientImage(const Image &source);
+
+		/// @brief テクスチャの元画像から、描画サイズでのピクセル単位の当たり判定マスクを作る
+		/// @param source テクスチャの元画像
+		/// @return マスク
+		static std::shared_ptr<const AlphaMask> CreateHitMask(const Image &source);
+
 	private:
 		/// @brief 画面端のどこを開始点と終了点にするかランダムに決める @n
 		/// 自身がぎりぎり映らない、表示領域外の場所として決められる @n
@@ -430,5 +519,8 @@ namespace UFOCat::Core
 		/// ** `m_edgeDirection` を同時に変更し、更に決まった開始点は、自動的に `position` に代入される **
 		/// @return 開始点と終了点のタプル  [0] が開始点、[1] が終了点
 		std::tuple<Vec2, Vec2> m_changeScreenEdgePosition();
+
+		/// @brief 当たり判定の位置を現在の `position` に合わせる
+		void m_updateHitArea();
 	};
 }
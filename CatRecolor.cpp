@@ -0,0 +1,70 @@
+﻿# include "CatRecolor.hpp"
+
+namespace UFOCat::Core
+{
+	std::pair<PixelShader, ConstantBuffer<CatRecolor::Constants>> &CatRecolor::m_resources()
+	{
+		// 0 番はエンジンが使うので、毛色は 1 番の定数バッファで渡す
+		static std::pair<PixelShader, ConstantBuffer<Constants>> resources
+		{
+			HLSL{ U"shader/recolor.hlsl", U"PS" }
+			| GLSL{ U"shader/recolor.frag", { { U"PSConstants2D", 0 }, { U"RecolorConstants", 1 } } },
+			ConstantBuffer<Constants>{}
+		};
+
+# if _DEBUG
+		if (static bool isReported = false;
+			(not resources.first) and (not isReported))
+		{
+			Logger << U"[CatRecolor] Failed to load the recolor shader. Base textures are drawn as is.";
+			isReported = true;
+		}
+# endif
+
+		return resources;
+	}
+
+	CatRecolor::CatRecolor(const Texture &mask, const CatData &data)
+		: m_mask{ mask }
+		, m_constants{}
+	{
+		// 毛色が領域の数より少なければ、最後の色で埋める
+		for (size_t i = 0; i < MaxRegions; ++i)
+		{
+			const ColorF color = data.regionColors.isEmpty()
+				? ColorF{ Palette::White }
+				: ColorF{ data.regionColors[Min(i, data.regionColors.size() - 1)] };
+
+			m_constants.regionColors[i] = color.toFloat4();
+		}
+	}
+
+	bool CatRecolor::IsAvailable()
+	{
+		return static_cast<bool>(m_resources().first);
+	}
+
+	void CatRecolor::draw(const TextureRegion &region, const Vec2 &position, const ColorF &diffuse) const
+	{
+		auto &[shader, constants] = m_resources();
+
+		if ((not shader) or (not m_mask))
+		{
+			region.draw(position, diffuse);
+			return;
+		}
+
+		// 定数バッファは描画コマンドごとに記録されるので、猫ごとに書き換えてよい
+		*constants = m_constants;
+		Graphics2D::SetPSConstantBuffer(1, constants);
+		Graphics2D::SetPSTexture(1, m_mask);
+
+		const ScopedCustomShader2D scoped{ shader };
+		region.draw(position, diffuse);
+	}
+
+	void CatRecolor::drawAt(const TextureRegion &region, const Vec2 &center, const ColorF &diffuse) const
+	{
+		draw(region, center - region.size / 2, diffuse);
+	}
+}
@@ -0,0 +1,57 @@
+﻿# pragma once
+# include "CatData.hpp"
+
+namespace UFOCat::Core
+{
+	/// @brief 共通のベース画像を、領域ごとの色マスクと `CatData` の毛色を使って描画時に色付けするための情報 @n
+	/// 毛色違いの猫ごとに画像を用意する代わりに、ベース画像（明るい灰色で陰影だけ付けたもの）と
+	/// 色マスク（R, G, B チャンネルがそれぞれ 1, 2, 3 番目の毛色を塗る領域の重み）を使い回し、
+	/// 猫ごとには毛色の値（数十バイト）だけを持つ
+	/// @note シェーダが読み込めない環境では、ベース画像をそのまま描画する
+	class CatRecolor
+	{
+	public:
+		/// @brief 色分けできる領域の数（色マスクの R, G, B）
+		constexpr static size_t MaxRegions = 3;
+
+		/// @brief シェーダに渡す定数バッファ
+		struct Constants
+		{
+			/// @brief 領域ごとの毛色
+			Float4 regionColors[MaxRegions];
+		};
+
+	private:
+		/// @brief 領域ごとの色マスク
+		Texture m_mask;
+
+		/// @brief この猫の毛色
+		Constants m_constants;
+
+		/// @brief シェーダと定数バッファを取得する 初めて呼ばれたときに読み込む
+		/// @return 読み込みに失敗していたら、シェーダが空になっている
+		static std::pair<PixelShader, ConstantBuffer<Constants>> &m_resources();
+
+	public:
+		/// @brief 色マスクと猫のデータから作る
+		/// @param mask 領域ごとの色マスク（ベース画像と同じ大きさ）
+		/// @param data 猫のデータ（`regionColors` の順に各領域を塗る）
+		CatRecolor(const Texture &mask, const CatData &data);
+
+		/// @brief 色付けのシェーダが使えるかどうか
+		/// @return 使えれば `true`
+		static bool IsAvailable();
+
+		/// @brief ベース画像を色付けして描画する
+		/// @param region ベース画像（クリップや拡大縮小をしたもの）
+		/// @param position 左上の位置
+		/// @param diffuse 乗算する色
+		void draw(const TextureRegion &region, const Vec2 &position, const ColorF &diffuse = Palette::White) const;
+
+		/// @brief ベース画像を色付けして、中心の位置を指定して描画する
+		/// @param region ベース画像（クリップや拡大縮小をしたもの）
+		/// @param center 中心の位置
+		/// @param diffuse 乗算する色
+		void drawAt(const TextureRegion &region, const Vec2 &center, const ColorF &diffuse = Palette::White) const;
+	};
+}
@@ -0,0 +1,232 @@
+﻿# include "CatTextureResidency.hpp"
+# include "Common.hpp"
+
+namespace UFOCat::Util
+{
+	CatTextureResidency::CatTextureResidency(size_t budget)
+		: m_budget{ budget }
+	{}
+
+	String CatTextureResidency::m_maskName(size_t id)
+	{
+		return Cat(id) + U"Mask";
+	}
+
+	String CatTextureResidency::m_touch(size_t id)
+	{
+		const String name = Cat(id);
+
+		if (not TextureAsset::IsRegistered(name))
+		{
+			m_assets.registerTexture(name, path(id));
+		}
+
+		// 同じテクスチャを続けて要求された場合（毎フレームの描画など）は数えない
+		if ((not m_resident.isEmpty()) and (m_resident.back() == id))
+		{
+			return name;
+		}
+
+		if (m_resident.contains(id))
+		{
+			++m_stats.hits;
+
+			// 最近使われたものとして一番後ろに移す
+			m_resident.remove(id);
+			m_resident << id;
+		}
+		else
+		{
+			++m_stats.misses;
+
+			// 色マスクがあれば、ベース画像と一緒に読み込み・解放するので合わせて数える
+			if (not m_bytes.contains(id))
+			{
+				const auto mask = m_maskPaths.find(id);
+				m_bytes[id] = m_estimateBytes(path(id)) + ((mask != m_maskPaths.end()) ? m_estimateBytes(mask->second) : 0);
+			}
+
+			m_resident << id;
+			m_residentBytes += m_bytes[id];
+
+			// 今読み込もうとしているもの以外から空きを作る
+			m_evict(id);
+		}
+
+		return name;
+	}
+
+	size_t CatTextureResidency::m_estimateBytes(FilePathView path) const
+	{
+		// ヘッダーだけ読んで大きさを調べる 読めなければ 512 x 512 とみなす
+		const Size size = m_assets.imageInfo(path).map([](const ImageInfo &info) { return info.size; }).value_or(Size{ 512, 512 });
+
+		return static_cast<size_t>(size.x) * size.y * sizeof(Color);
+	}
+
+	void CatTextureResidency::m_evict(Optional<size_t> keep)
+	{
+		// 前のほうほど最近使われていない
+		for (auto it = m_resident.begin(); (m_residentBytes > m_budget) and (it != m_resident.end());)
+		{
+			if ((keep and (*it == *keep)) or m_pins.contains(*it))
+			{
+				++it;
+				continue;
+			}
+
+			TextureAsset::Release(Cat(*it));
+
+			if (const String mask = m_maskName(*it);
+				TextureAsset::IsRegistered(mask))
+			{
+				TextureAsset::Release(mask);
+			}
+
+			m_residentBytes -= m_bytes[*it];
+			++m_stats.evictions;
+			it = m_resident.erase(it);
+		}
+	}
+
+	size_t CatTextureResidency::scan(const AssetPack &assets, StringView directory)
+	{
+		m_assets = assets;
+
+		// フォルダ直下の、ファイル名が数字の画像を ID ごとに表に入れる
+		const auto collect = [&assets](StringView directory, HashTable<size_t, FilePath> &paths)
+		{
+			size_t count = 0;
+
+			for (const auto &path : assets.list(directory))
+			{
+				if (const auto id = ParseOpt<size_t>(FileSystem::BaseName(path)))
+				{
+					paths[*id] = path;
+					++count;
+				}
+			}
+
+			return count;
+		};
+
+		// mask フォルダがなければ空のリストになる
+		collect(U"{}/mask"_fmt(directory), m_maskPaths);
+
+		return collect(directory, m_paths);
+	}
+
+	bool CatTextureResidency::isEmpty() const noexcept
+	{
+		return m_paths.empty();
+	}
+
+	bool CatTextureResidency::contains(size_t id) const
+	{
+		return m_paths.contains(id);
+	}
+
+	FilePathView CatTextureResidency::path(size_t id) const
+	{
+		if (const auto it = m_paths.find(id); it != m_paths.end())
+		{
+			return it->second;
+		}
+
+		throw Error{ U"Texture for cat ID {} is not found."_fmt(id) };
+	}
+
+	Image CatTextureResidency::loadImage(size_t id) const
+	{
+		return m_assets.loadImage(path(id));
+	}
+
+	void CatTextureResidency::prefetch(size_t id)
+	{
+		TextureAsset::LoadAsync(m_touch(id));
+	}
+
+	bool CatTextureResidency::isReady(size_t id) const
+	{
+		return TextureAsset::IsReady(Cat(id));
+	}
+
+	Texture CatTextureResidency::get(size_t id)
+	{
+		return TextureAsset(m_touch(id));
+	}
+
+	Optional<Core::CatRecolor> CatTextureResidency::getRecolor(const Core::CatData &cat)
+	{
+		if (not cat.isRecolored)
+		{
+			return none;
+		}
+
+		const auto it = m_maskPaths.find(cat.textureId);
+
+		if (it == m_maskPaths.end())
+		{
+			throw Error{ U"Recolor mask for texture ID {} is not found."_fmt(cat.textureId) };
+		}
+
+		// 色マスクはベース画像と一緒に読み込み・解放する
+		m_touch(cat.textureId);
+
+		const String name = m_maskName(cat.textureId);
+
+		if (not TextureAsset::IsRegistered(name))
+		{
+			m_assets.registerTexture(name, it->second);
+		}
+
+		return Core::CatRecolor{ TextureAsset(name), cat };
+	}
+
+	void CatTextureResidency::pin(size_t id)
+	{
+		++m_pins[id];
+	}
+
+	void CatTextureResidency::unpin(size_t id)
+	{
+		if (const auto it = m_pins.find(id); it != m_pins.end())
+		{
+			if (--it->second == 0)
+			{
+				m_pins.erase(it);
+			}
+		}
+	}
+
+	void CatTextureResidency::setBudget(size_t budget)
+	{
+		m_budget = budget;
+		m_evict();
+	}
+
+	void CatTextureResidency::trim()
+	{
+		m_evict();
+
+# if _DEBUG
+		Logger << U"[CatTextureResidency] {} textures, {:.1f}/{:.1f} MiB (hit {}, miss {}, evicted {})"_fmt(
+			m_resident.size(), m_residentBytes / 1048576.0, m_budget / 1048576.0, m_stats.hits, m_stats.misses, m_stats.evictions);
+# endif
+	}
+
+	size_t CatTextureResidency::residentCount() const noexcept
+	{
+		return m_resident.size();
+	}
+
+	size_t CatTextureResidency::residentBytes() const noexcept
+	{
+		return m_residentBytes;
+	}
+
+	const CatTextureResidency::Stats &CatTextureResidency::stats() const noexcept
+	{
+		return m_stats;
+	}
+}
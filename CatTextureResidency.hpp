@@ -0,0 +1,164 @@
+﻿# pragma once
+# include "CatRecolor.hpp"
+# include "AssetPack.hpp"
+
+namespace UFOCat::Util
+{
+	/// @brief UFO猫のテクスチャを、必要になったときに初めてアセット登録・読み込みし、
+	/// 読み込んだままにしておくテクスチャの合計サイズを予算以下に抑える管理クラス @n
+	/// テクスチャはカタログ上の ID（ファイル名の数字）で管理するので、`GameData::cats` の並びとは関係ない
+	/// @note 予算を超えたら、スポーン中の猫などで使用中（`pin()` されている）のもの以外を、最近使われていない順に解放する @n
+	/// シーンをまたいでも予算に余裕があるうちは解放しないので、続けて使う猫は読み込み直さずに済む
+	class CatTextureResidency
+	{
+	public:
+		/// @brief キャッシュの効き具合の記録
+		struct Stats
+		{
+			/// @brief 読み込み済み（または読み込み中）のテクスチャを要求された回数
+			size_t hits = 0;
+
+			/// @brief 読み込まれていないテクスチャを要求された回数
+			size_t misses = 0;
+
+			/// @brief 予算を超えたために解放した回数
+			size_t evictions = 0;
+		};
+
+	private:
+		/// @brief 読み込んだままにしておくテクスチャの合計サイズの予算 [bytes]
+		size_t m_budget;
+
+		/// @brief 画像を読み込む元
+		AssetPack m_assets;
+
+		/// @brief カタログ上の ID と画像ファイルの論理パスの対応
+		HashTable<size_t, FilePath> m_paths;
+
+		/// @brief ベース画像の ID と、色付け用の色マスクの画像ファイルのパスの対応
+		HashTable<size_t, FilePath> m_maskPaths;
+
+		/// @brief 読み込み中、または読み込み済みのテクスチャの ID 最近使われたものほど後ろに並ぶ
+		Array<size_t> m_resident;
+
+		/// @brief テクスチャ（と色マスク）の ID ごとの、GPU 上でのおおよそのサイズ [bytes]
+		HashTable<size_t, size_t> m_bytes;
+
+		/// @brief 読み込み中、または読み込み済みのテクスチャの合計サイズ [bytes]
+		size_t m_residentBytes = 0;
+
+		/// @brief 使用中のテクスチャの ID と、`pin()` された回数
+		HashTable<size_t, uint32> m_pins;
+
+		/// @brief キャッシュの効き具合の記録
+		Stats m_stats;
+
+		/// @brief テクスチャアセットを登録し、最近使われたものとして記録する @n
+		/// 新しく読み込むことで予算を超えるなら、使われていないものから解放する
+		/// @param id カタログ上の ID
+		/// @return アセット名
+		String m_touch(size_t id);
+
+		/// @brief 画像ファイルから、テクスチャにしたときのおおよそのサイズを求める
+		/// @param path 画像ファイルの論理パス
+		/// @return RGBA 8bit として計算したサイズ [bytes]
+		size_t m_estimateBytes(FilePathView path) const;
+
+		/// @brief 予算に収まるまで、使用中でないテクスチャを最近使われていない順に解放する
+		/// @param keep 解放しない ID（今まさに要求されたものなど）
+		void m_evict(Optional<size_t> keep = none);
+
+		/// @brief 色マスクのアセット名を取得する
+		/// @param id ベース画像の ID
+		/// @return アセット名
+		static String m_maskName(size_t id);
+
+	public:
+		/// @brief 予算の既定値（512 x 512 の RGBA テクスチャで 64 枚分）
+		constexpr static size_t DefaultBudget = 64 * 1024 * 1024;
+
+		/// @brief 予算を指定して初期化する
+		/// @param budget 読み込んだままにしておくテクスチャの合計サイズの予算 [bytes]
+		explicit CatTextureResidency(size_t budget = DefaultBudget);
+
+		/// @brief フォルダ内の画像ファイルを、ファイル名（拡張子を除く）を ID として登録する @n
+		/// `mask` フォルダがあれば、その中の画像も同じ ID のベース画像の色マスクとして登録する @n
+		/// この時点ではテクスチャの読み込みもアセット登録もしない
+		/// @param assets 画像を読み込む元（パックならマニフェストを引くだけで済む）
+		/// @param directory 画像ファイルの入っているフォルダの論理パス
+		/// @return 登録した画像の数
+		/// @remarks ファイル名が数字でないものは無視する
+		size_t scan(const AssetPack &assets, StringView directory);
+
+		/// @brief 画像ファイルが1つも登録されていないかどうか
+		/// @return 登録されていなければ `true`
+		bool isEmpty() const noexcept;
+
+		/// @brief ID に対応する画像ファイルがあるかどうか
+		/// @param id カタログ上の ID
+		/// @return あれば `true`
+		bool contains(size_t id) const;
+
+		/// @brief ID に対応する画像ファイルの論理パスを取得する
+		/// @param id カタログ上の ID
+		/// @return 画像ファイルの論理パス
+		/// @remarks 登録されていない ID なら例外が投げられる
+		FilePathView path(size_t id) const;
+
+		/// @brief ID に対応する画像を、テクスチャにせずに読み込む
+		/// @param id カタログ上の ID
+		/// @return 画像
+		Image loadImage(size_t id) const;
+
+		/// @brief テクスチャの非同期読み込みを始める
+		/// @param id カタログ上の ID
+		void prefetch(size_t id);
+
+		/// @brief テクスチャの読み込みが終わっているかどうか
+		/// @param id カタログ上の ID
+		/// @return 読み込みが終わっていれば `true`
+		bool isReady(size_t id) const;
+
+		/// @brief テクスチャを取得する まだ読み込まれていなければ、その場で読み込む
+		/// @param id カタログ上の ID
+		/// @return テクスチャ
+		Texture get(size_t id);
+
+		/// @brief 色付けして描画する猫のための情報を取得する まだ色マスクが読み込まれていなければ、その場で読み込む
+		/// @param cat 猫のデータ
+		/// @return 色付けしない猫なら `none`
+		/// @remarks 色付けする猫なのに、色マスクが登録されていなければ例外が投げられる
+		Optional<Core::CatRecolor> getRecolor(const Core::CatData &cat);
+
+		/// @brief テクスチャを使用中にして、予算を超えても解放されないようにする @n
+		/// スポーンさせる猫のテクスチャなど、シーンの間ずっと使うものに対して呼び出す
+		/// @param id カタログ上の ID
+		/// @note 同じ ID に何度呼んでもよく、同じ回数だけ `unpin()` すると使用中でなくなる
+		void pin(size_t id);
+
+		/// @brief `pin()` した使用中の印を1つ外す
+		/// @param id カタログ上の ID
+		void unpin(size_t id);
+
+		/// @brief 予算を変更する 超えていれば、その場で解放する
+		/// @param budget 予算 [bytes]
+		void setBudget(size_t budget);
+
+		/// @brief 予算を超えている分のテクスチャを、使用中でないものから最近使われていない順に解放する @n
+		/// `unpin()` した後など、使い終わったテクスチャが残っていてもよいタイミング（シーンの終わりなど）で呼び出す
+		/// @note アセット登録は残すので、解放したテクスチャも `get()` や `prefetch()` でまた読み込める
+		void trim();
+
+		/// @brief 読み込み中、または読み込み済みのテクスチャの数を取得する
+		/// @return テクスチャの数
+		size_t residentCount() const noexcept;
+
+		/// @brief 読み込み中、または読み込み済みのテクスチャの合計サイズを取得する
+		/// @return 合計サイズ [bytes]
+		size_t residentBytes() const noexcept;
+
+		/// @brief キャッシュの効き具合の記録を取得する
+		/// @return 記録
+		const Stats &stats() const noexcept;
+	};
+}
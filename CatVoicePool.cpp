@@ -0,0 +1,162 @@
+﻿# include "CatVoicePool.hpp"
+
+namespace UFOCat::Util
+{
+	double CatVoicePool::m_priority(const Voice &voice, double time) const
+	{
+		if (not voice.effect)
+		{
+			return 0.0;
+		}
+
+		const double progress = (time - voice.startTime) / m_lengths[*voice.effect];
+
+		return (progress < 1.0) ? voice.priority * (1.0 - progress) : 0.0;
+	}
+
+	void CatVoicePool::m_start(Voice &voice, const Request &request, const Vec2 &listener, double time)
+	{
+		if (voice.effect)
+		{
+			voice.audios[*voice.effect].stopAllShots();
+		}
+
+		// 左右の位置で振り分け、カーソルから遠いほど小さく鳴らす
+		const double pan = Clamp((request.position.x / Scene::Width()) * 2.0 - 1.0, -1.0, 1.0) * 0.8;
+		const double distance = request.position.distanceFrom(listener) / Scene::Size().length();
+		const double volume = m_volume * Math::Lerp(1.0, 0.3, Clamp(distance, 0.0, 1.0));
+
+		voice.audios[request.effect].playOneShot(volume, pan);
+		voice.effect = request.effect;
+		voice.priority = request.priority;
+		voice.startTime = time;
+	}
+
+	void CatVoicePool::load(const SoundEffectCache &soundEffects, const Array<AssetName> &names, size_t voiceCount)
+	{
+		// 波形はオーディオを作り終えたら要らないので、ここでだけ持つ
+		load(names, names.map([&soundEffects](const AssetName &name) { return soundEffects.decode(name); }), voiceCount);
+	}
+
+	void CatVoicePool::load(const Array<AssetName> &names, const Array<Wave> &waves, size_t voiceCount)
+	{
+		stopAll();
+
+		m_names = names;
+		m_lengths = waves.map([](const Wave &wave) { return Max(wave.lengthSec(), 0.001); });
+
+		m_voices.clear();
+		m_voices.resize(voiceCount);
+		m_bytes = 0;
+
+		for (auto &voice : m_voices)
+		{
+			voice.audios = waves.map([](const Wave &wave) { return Audio{ wave }; });
+		}
+
+		for (const auto &wave : waves)
+		{
+			m_bytes += wave.size_bytes() * voiceCount;
+		}
+
+		m_requests.clear();
+		m_requests.reserve(voiceCount);
+	}
+
+	bool CatVoicePool::isEmpty() const noexcept
+	{
+		return m_voices.isEmpty();
+	}
+
+	void CatVoicePool::request(AssetNameView name, const Vec2 &position, const Vec2 &listener, double boost)
+	{
+		++m_stats.requested;
+
+		const auto it = std::find(m_names.begin(), m_names.end(), name);
+
+		if (it == m_names.end())
+		{
+			return;
+		}
+
+		const Request request{ static_cast<size_t>(it - m_names.begin()), position, boost / (1.0 + position.distanceFrom(listener) / 200.0) };
+
+		// ボイスの数より多くの要求は鳴らせないので、優先度の高いものだけを残す
+		if (m_requests.size() < m_voices.size())
+		{
+			m_requests << request;
+			return;
+		}
+
+		const auto lowest = std::min_element(m_requests.begin(), m_requests.end(), [](const Request &a, const Request &b) { return a.priority < b.priority; });
+
+		if ((lowest != m_requests.end()) and (lowest->priority < request.priority))
+		{
+			*lowest = request;
+		}
+
+		++m_stats.dropped;
+	}
+
+	void CatVoicePool::update(const Vec2 &listener, double time)
+	{
+		std::sort(m_requests.begin(), m_requests.end(), [](const Request &a, const Request &b) { return a.priority > b.priority; });
+
+		for (const auto &request : m_requests)
+		{
+			// 空いているボイスがあれば、優先度は 0 なのでそれが選ばれる
+			auto &&voice = *std::min_element(m_voices.begin(), m_voices.end(), [this, time](const Voice &a, const Voice &b) { return m_priority(a, time) < m_priority(b, time); });
+			const double priority = m_priority(voice, time);
+
+			if (priority >= request.priority)
+			{
+				++m_stats.dropped;
+				continue;
+			}
+
+			if (priority > 0.0)
+			{
+				++m_stats.stolen;
+			}
+
+			m_start(voice, request, listener, time);
+			++m_stats.started;
+		}
+
+		m_requests.clear();
+	}
+
+	void CatVoicePool::stopAll()
+	{
+		for (auto &voice : m_voices)
+		{
+			if (voice.effect)
+			{
+				voice.audios[*voice.effect].stopAllShots();
+				voice.effect.reset();
+			}
+		}
+
+		m_requests.clear();
+	}
+
+	void CatVoicePool::setVolume(double volume) noexcept
+	{
+		m_volume = volume;
+	}
+
+	size_t CatVoicePool::activeCount(double time) const
+	{
+		return m_voices.count_if([this, time](const Voice &voice) { return m_priority(voice, time) > 0.0; });
+	}
+
+	size_t CatVoicePool::residentBytes() const noexcept
+	{
+		return m_bytes;
+	}
+
+	const CatVoicePool::Stats &CatVoicePool::stats() const noexcept
+	{
+		return m_stats;
+	}
+}
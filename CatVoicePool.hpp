@@ -0,0 +1,149 @@
+﻿# pragma once
+# include "SoundEffectCache.hpp"
+
+namespace UFOCat::Util
+{
+	/// @brief UFO猫の鳴き声を、決まった数の発音（ボイス）だけで鳴らすミキサー @n
+	/// 鳴らしたい要求はフレームごとにためておき、カーソルに近いものから空いているボイスに割り当てる @n
+	/// ボイスが足りなければ、優先度が一番低い（カーソルから遠い、または鳴り終わりかけの）ボイスを止めて奪う
+	/// @note 画面にいる猫が何匹になっても同時に鳴るのはボイスの数までなので、オーディオの負荷は変わらない
+	class CatVoicePool
+	{
+	public:
+		/// @brief 鳴らした回数などの記録
+		struct Stats
+		{
+			/// @brief 要求された回数
+			size_t requested = 0;
+
+			/// @brief 実際に鳴らした回数
+			size_t started = 0;
+
+			/// @brief 鳴っているボイスを止めて奪った回数
+			size_t stolen = 0;
+
+			/// @brief ボイスが足りず、鳴らさなかった回数
+			size_t dropped = 0;
+		};
+
+	private:
+		/// @brief 鳴らしたい要求
+		struct Request
+		{
+			/// @brief 効果音の番号
+			size_t effect;
+
+			/// @brief 鳴らす位置のシーン座標
+			Vec2 position;
+
+			/// @brief 優先度 カーソルに近いほど大きい
+			double priority;
+		};
+
+		/// @brief 1つの発音
+		struct Voice
+		{
+			/// @brief 効果音ごとのオーディオ 別々の `Audio` でないと、1つだけ止めることができない
+			/// @note ゲーム中に作ると重いので、`load()` で全て作っておく
+			Array<Audio> audios;
+
+			/// @brief 鳴らしている効果音の番号 鳴らしていなければ `none`
+			Optional<size_t> effect;
+
+			/// @brief 鳴らし始めたときの優先度
+			double priority = 0.0;
+
+			/// @brief 鳴らし始めた時刻 [s]
+			double startTime = 0.0;
+		};
+
+		/// @brief 効果音のアセット名
+		Array<AssetName> m_names;
+
+		/// @brief 効果音の長さ [s]
+		Array<double> m_lengths;
+
+		/// @brief 全てのボイス
+		Array<Voice> m_voices;
+
+		/// @brief このフレームの要求 優先度の高いものをボイスの数までしか残さない
+		Array<Request> m_requests;
+
+		/// @brief 全てのボイスのオーディオの合計サイズ [bytes]
+		size_t m_bytes = 0;
+
+		/// @brief 全体の音量
+		double m_volume = 1.0;
+
+		/// @brief 鳴らした回数などの記録
+		Stats m_stats;
+
+		/// @brief ボイスの今の優先度を求める 鳴り終わりに近いほど下がる
+		/// @param voice ボイス
+		/// @param time 今の時刻 [s]
+		/// @return 優先度 鳴らしていなければ 0
+		double m_priority(const Voice &voice, double time) const;
+
+		/// @brief ボイスで効果音を鳴らす
+		/// @param voice ボイス
+		/// @param request 鳴らしたい要求
+		/// @param listener 聞いている位置のシーン座標
+		/// @param time 今の時刻 [s]
+		void m_start(Voice &voice, const Request &request, const Vec2 &listener, double time);
+
+	public:
+		/// @brief ボイスの数の既定値
+		constexpr static size_t DefaultVoiceCount = 6;
+
+		/// @brief 効果音を読み込んで、全てのボイスのオーディオを作っておく
+		/// @param soundEffects 効果音を読み込む元
+		/// @param names 鳴らす効果音のアセット名
+		/// @param voiceCount ボイスの数
+		void load(const SoundEffectCache &soundEffects, const Array<AssetName> &names, size_t voiceCount = DefaultVoiceCount);
+
+		/// @brief デコード済みの効果音から、全てのボイスのオーディオを作っておく @n
+		/// デコードはワーカースレッドで済ませておき、オーディオを作るのだけをメインスレッドで行うときに使う
+		/// @param names 鳴らす効果音のアセット名
+		/// @param waves `names` と同じ順に並べた、効果音の波形
+		/// @param voiceCount ボイスの数
+		void load(const Array<AssetName> &names, const Array<Wave> &waves, size_t voiceCount = DefaultVoiceCount);
+
+		/// @brief 効果音が読み込まれていないかどうか
+		/// @return 読み込まれていなければ `true`
+		bool isEmpty() const noexcept;
+
+		/// @brief 鳴き声を鳴らすように要求する 実際に鳴らすかどうかは `update()` で決まる
+		/// @param name 効果音のアセット名
+		/// @param position 鳴らす位置のシーン座標
+		/// @param listener 聞いている位置のシーン座標（優先度の計算に使う）
+		/// @param boost 優先度に掛ける値 目立たせたい鳴き声には大きくする
+		void request(AssetNameView name, const Vec2 &position, const Vec2 &listener, double boost = 1.0);
+
+		/// @brief このフレームの要求を、優先度の高いものからボイスに割り当てて鳴らす @n
+		/// 毎フレーム 1度 呼び出す
+		/// @param listener 聞いている位置のシーン座標（音量の計算に使う）
+		/// @param time 今の時刻 [s]
+		void update(const Vec2 &listener, double time = Scene::Time());
+
+		/// @brief 全てのボイスを止める
+		void stopAll();
+
+		/// @brief 全体の音量を設定する
+		/// @param volume 音量
+		void setVolume(double volume) noexcept;
+
+		/// @brief 鳴っているボイスの数を取得する
+		/// @param time 今の時刻 [s]
+		/// @return ボイスの数
+		size_t activeCount(double time = Scene::Time()) const;
+
+		/// @brief 全てのボイスのオーディオの合計サイズを取得する @n
+		/// `SoundEffectCache` とは別に持っている分なので、効果音の予算からはこの分を差し引いておくとよい
+		/// @return 合計サイズ [bytes]
+		size_t residentBytes() const noexcept;
+
+		/// @brief 鳴らした回数などの記録を取得する
+		/// @return 記録
+		const Stats &stats() const noexcept;
+	};
+}
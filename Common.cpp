@@ -1,4 +1,5 @@
 ﻿# include "Common.hpp"
+# include "Hash.hpp"
 
 namespace UFOCat
 {
@@ -34,10 +35,9 @@ namespace UFOCat
 			return total;
 		}
 
-		size_t Score::Generic::ByLevel::GetMaxTheoretical(size_t levelCount)
+		size_t Score::Generic::ByLevel::ComputeMaxTheoretical(size_t levelCount)
 		{
-			// static フィールドのため初回呼び出し時にしか計算されない
-			static size_t sum = Array<ByLevel>{ levelCount }
+			return Array<ByLevel>{ levelCount }
 				.each_index([](size_t i, ByLevel& score)
 					{
 						// 反応時間は 0.1s ということで、バカ早くしておく
@@ -49,13 +49,27 @@ namespace UFOCat
 							return score.calculateTotal();
 						})
 						.sum();
+		}
+
+		size_t Score::Generic::ByLevel::GetMaxTheoretical(size_t levelCount)
+		{
+			// 設定されているレベル数と同じなら、計算済みの値を使う
+			if ((levelCount == 0) or (levelCount == m_levelCount))
+			{
+				return m_maxTheoretical;
+			}
 
-			return sum;
+			return ComputeMaxTheoretical(levelCount);
 		}
 
 		void Score::Generic::ByLevel::SetLevelCount(size_t count)
 		{
-			GetMaxTheoretical(count);
+			// レベル数が変わったとき（ホットリロードなど）だけ計算し直す
+			if (count != m_levelCount)
+			{
+				m_levelCount = count;
+				m_maxTheoretical = ComputeMaxTheoretical(count);
+			}
 		}
 
 		size_t UFOCat::Core::Score::Generic::calculateTotal()
@@ -114,6 +128,20 @@ namespace UFOCat
 		// 結果格納用
 		Array<CatData> results;
 
+		// 品種、模様、毛色の名前に、出てきた順に番号を割り振るための表
+		HashTable<String, uint16> breedIds;
+		HashTable<String, uint16> patternIds;
+		HashTable<String, uint16> colorIds;
+
+		// ID の重複チェック用
+		HashSet<size_t> catalogIds;
+
+		// 名前の番号を取得する 初めて出てきた名前なら新しい番号を割り振る
+		const auto intern = [](HashTable<String, uint16> &ids, StringView name)
+		{
+			return ids.try_emplace(String{ name }, static_cast<uint16>(ids.size())).first->second;
+		};
+
 		if (data.getType() == JSONValueType::Array)
 		{
 			for (const auto& d : data)
@@ -121,6 +149,11 @@ namespace UFOCat
 				if (d.value.getType() == JSONValueType::Object)
 				{
 					size_t id = d.value[U"id"].get<size_t>();
+
+					if (not catalogIds.emplace(id).second)
+					{
+						throw Error{ U"Cat ID {} is duplicated in `cat_data.json`."_fmt(id) };
+					}
 					String breed = d.value[U"breed"].get<String>();
 
 					// 以後、仮の文字列格納用変数は data_ で始める
@@ -135,7 +168,8 @@ namespace UFOCat
 
 					// テーブルをつくり、色データを区切り文字で分割して取得しながら記録
 					HashTable<String, Color> colors;
-					data_color.split(U'|').each([&isDilute, &colors](const auto& name)
+					Array<Color> regionColors;
+					data_color.split(U'|').each([&isDilute, &colors, &regionColors](const auto& name)
 					{
 						Color temp = Palette::White;
 
@@ -202,12 +236,43 @@ namespace UFOCat
 						}
 
 						colors[name] = temp;
+						regionColors << temp;
 					});
 				
 					bool isLongHair = d.value[U"isLongHair"].get<bool>();
 
+					CatData cat{ id, breed, colors, pattern, isLongHair };
+
+					// 配列の中での位置は ID とは別に持っておく
+					cat.index = results.size();
+					cat.regionColors = regionColors;
+
+					// ベース画像が指定されていれば、自分の画像の代わりにそれを色付けして使う
+					if (d.value.hasElement(U"base"))
+					{
+						cat.textureId = d.value[U"base"].get<size_t>();
+						cat.isRecolored = true;
+					}
+
+					// 比較用に、特徴を整数の ID とビットマスクに置き換えておく
+					cat.breedId = intern(breedIds, breed);
+					cat.patternId = intern(patternIds, CatData::GetPatternClass(pattern));
+
+					for (const auto &[name, color] : colors)
+					{
+						if (const uint16 colorId = intern(colorIds, name);
+							colorId < 64)
+						{
+							cat.colorMask |= (uint64{ 1 } << colorId);
+						}
+						else
+						{
+							throw Error{ U"Too many kinds of colors in `cat_data.json`. (max: 64)" };
+						}
+					}
+
 					// 作成したインスタンスを格納
-					results << CatData{ id, breed, colors, pattern, isLongHair };
+					results << cat;
 				}
 			}
 
@@ -217,17 +282,87 @@ namespace UFOCat
 		throw Error{ U"Parameter is not JSONValueType::Array." };
 	}
 
-	Array<UFOCat::Core::LevelData> UFOCat::LoadLevelData()
+	Array<std::shared_ptr<const AlphaMask>> UFOCat::LoadHitMasks(const Array<std::shared_ptr<CatData>> &cats, const Util::CatTextureResidency &textures)
 	{
-		// JSON からデータを読み込む
-		const JSON json = JSON::Load(U"level_data.json");
+		// 同じ画像を使う猫（色付けする猫など）どうしではマスクも共有する
+		HashTable<size_t, std::shared_ptr<const AlphaMask>> shared;
+
+		// cats と同じ順番で作るので、インデックスが一致する
+		auto &&masks = cats.map([&textures, &shared](const auto &cat)
+		{
+			if (const auto it = shared.find(cat->textureId); it != shared.end())
+			{
+				return it->second;
+			}
+
+			const FilePathView path = textures.path(cat->textureId);
+			const Image source = textures.loadImage(cat->textureId);
+			auto &&mask = CatObject::CreateHitMask(source);
+
+# if _DEBUG
+			// 実際に描画されるアルファ値とマスクの食い違いが大きければ知らせる
+			if (const double agreement = mask->agreement(CatObject::ToClientImage(source));
+				agreement < 0.97)
+			{
+				Logger << U"[AlphaMask] `{}` matches only {:.1f}% of rendered alpha."_fmt(path, agreement * 100);
+			}
+# endif
+			shared.emplace(cat->textureId, mask);
+			return mask;
+		});
+
+# if _DEBUG
+		size_t totalBytes = 0;
+
+		for (const auto &[textureId, mask] : shared)
+		{
+			totalBytes += mask->byteSize();
+		}
+
+		Logger << U"[AlphaMask] {} masks, {} bytes in total."_fmt(shared.size(), totalBytes);
+# endif
+
+		return masks;
+	}
+
+	Array<UFOCat::Core::LevelData> UFOCat::LoadLevelData(FilePathView path)
+	{
+		// 元の JSON のハッシュ値で、キャッシュがそのまま使えるか確かめる
+		const Blob source{ path };
+
+		if (source.isEmpty())
+		{
+			throw Error{ U"Failed to load `{}`"_fmt(path) };
+		}
+
+		const uint64 sourceHash = Util::Fnv1a(source.data(), source.size());
+		const FilePath cachePath = LevelDataCache::GetPath(path);
+
+		if (auto &&cached = LevelDataCache::Load(cachePath, sourceHash))
+		{
+			return *cached;
+		}
+
+		// キャッシュが使えなければ JSON からデータを読み込む
+		const JSON json = JSON::Load(path);
 
 		// もし読み込みに失敗したら
 		if (not json)
 		{
-			throw Error{ U"Failed to load `level_data.json`" };
+			throw Error{ U"Failed to load `{}`"_fmt(path) };
 		}
 
+		auto &&levels = ParseLevelData(json);
+
+		// パースに成功したら、次回からはこちらを使う
+		// 書き込めない場所に置かれていても、毎回 JSON を読むだけなので問題ない
+		LevelDataCache::Save(cachePath, sourceHash, levels);
+
+		return levels;
+	}
+
+	Array<UFOCat::Core::LevelData> UFOCat::ParseLevelData(const JSON &json)
+	{
 		// data プロパティの中に配列として格納されている各レベルのデータ（元JSON参照）
 		const auto&& data = json[U"data"];
 
@@ -242,366 +377,109 @@ namespace UFOCat
 			{
 				if (d.value.isObject())
 				{
-					/*
-					 * 以後、JSONから抽出する仮の文字列格納用変数は data_ で始める
-					 * JSONのプロパティ値が
-					 *	数値型の場合はs3d::JSON の get<uint32>() を使ってパース
-					 *	文字列型の場合は、複数の型表現を包括しているため
-					 *	 一旦 getString() で文字列として取得し、
-					 *	 Duration や Rect、EasingFunction に変換する
-					 */
-
-					 // 1レベルの時間制限
-					Duration timeLimit = LevelData::ParseDuration(d.value[U"timeLimit"].get<String>());
-
-					// 類似度
-					uint32 similarity = d.value[U"similarity"].get<uint32>();
-
-					// 品種
-					LevelData::BreedData breedData{ };
-
-					// 品種データを読み込む
-					if (const auto& data_breedData = d.value[U"breedData"];
-						data_breedData.isObject())
-					{
-						breedData.similar = data_breedData[U"similar"].get<uint32>();
-						breedData.other = data_breedData[U"other"].get<uint32>();
-					}
-					else
-					{
-						throw Error(U"`breedData` is not object type.");
-					}
+					// 1レベル分パースしたら、結果に追加
+					result << LevelData::Parse(d.value);
+				}
 
-					// 出現ペース
-					LevelData::IntervalData intervalData{ };
+			}
+			return result;
+		}
+		throw Error(U"`level_data.json is invalid format.`");
+	}
 
-					// 出現ペースのデータを読み込む
-					if (const auto& data_intervalData = d.value[U"intervalData"];
-						data_intervalData.isObject())
-					{
-						intervalData.count = data_intervalData[U"count"].get<uint32>();
-						intervalData.period = LevelData::ParseDuration(data_intervalData[U"period"].getString());
-					}
-					else
-					{
-						throw Error(U"`intervalData` is not object type.");
-					}
+	void UFOCat::ApplyLevelDataChanges(GameData &data)
+	{
+		// レベルの途中でデータが変わると、抽選中のアクションの数などが合わなくなるので終わるまで待つ
+		// 変更は監視側に溜まっているので、待っている間の変更も取りこぼさない
+		if (data.isPlayingLevel)
+		{
+			return;
+		}
 
-					// このレベルでの使用アクション
-					Array<LevelData::ActionData> actionDataList{ };
+		auto &&levels = data.levelWatcher.poll(data.levels);
 
-					// 配列であることを確認してからアクションデータを全走査
-					if (const auto& data_actionData = d.value[U"actionData"];
-						data_actionData.isArray())
-					{
-						for (const auto& md : data_actionData)
-						{
-							// アクション名（メソッド名）
-							const String name = md.value[U"name"].getString();
-
-							// オーバーロード番号（何がどれに対応するかは、`cact` 参照）
-							const size_t overload = md.value[U"overload"].get<size_t>();
-
-							// `params` プロパティを格納する仮変数
-							const auto& data_params = md.value[U"params"];
-
-							// 発生確率
-							const double probability = md.value[U"probability"].get<double>();
-
-							/* -- こっから実際の引数として使えるタプルにするためのパース処理 -- */
-
-							// 引数リスト
-							Action::Generic params;
-
-							// 配列形式であることを確認
-							if (data_params.isArray())
-							{
-								// タプルの N 番目の要素を variant を外して取り出す
-								// tparam: N - 取り出す要素のインデックス
-								// tparam: TTuple - 取り出す対象のタプル型
-								// param: source - `Phase::ParseParameters()` の戻り値として得られた tuple (中身 variant)
-								const auto get_at = []<size_t N, typename TTuple>(const auto &source)
-								{
-									// source (タプル) の N 番目の要素を取り出す
-									// これは、variant<> であることが期待される
-									auto &&element = std::get<N>(source);
-
-									// TTuple の N 番目の要素の型を取得
-									// この型は、element の variant に格納されている本来の型と同じはず
-									using RealType = std::tuple_element_t<N, TTuple>;
-
-									// つまりこれは variant を外す処理となる
-									return std::get<RealType>(element);
-								};
-								// ジェネリックラムダのテンプレートは、実質ローカル関数でもテンプレートが使えるので便利だけど
-								// 明示的にテンプレートを指定するのは、operator() を使わなければならないので少し面倒
-
-								// 各アクションごとに場合分けしてパース処理
-								if (name == U"bound")
-								{
-									// `bound` は引数を取らないので、monostate をセットしておく
-									params = std::monostate{};
-								}
-								else if (name == U"cross")
-								{
-									switch (overload)
-									{
-										case 0:
-										{
-											auto p = LevelData::ParseParameters<Action::Cross::_0>(data_params);
-											params = std::make_tuple(
-												get_at.operator()<0, Action::Cross::_0>(p),
-												get_at.operator()<1, Action::Cross::_0>(p)
-											);
-											break;
-										}
-										case 1:
-										{
-											auto p = LevelData::ParseParameters<Action::Cross::_1>(data_params);
-											params = std::make_tuple(
-												get_at.operator()<0, Action::Cross::_1>(p)
-											);
-											break;
-										}
-										default:
-										{
-											throw Error(U"`cross` overload index is invalid. (valid range: 0 ~ {})"_fmt(Action::Cross::Count - 1));
-										}
-									}
-								}
-								else if (name == U"appear")
-								{
-									switch (overload)
-									{
-										case 0:
-										{
-											auto p = LevelData::ParseParameters<Action::Appear::_0>(data_params);
-											// 直書きでタプル作るのはちょっとダサいけど
-											// 固定長で作るという制約上しゃあないところが大きい
-											params = std::make_tuple
-											(
-												get_at.operator()<0, Action::Appear::_0>(p),
-												get_at.operator()<1, Action::Appear::_0>(p),
-												get_at.operator()<2, Action::Appear::_0>(p),
-												get_at.operator()<3, Action::Appear::_0>(p),
-												get_at.operator()<4, Action::Appear::_0>(p),
-												get_at.operator()<5, Action::Appear::_0>(p)
-											);
-											break;
-										}
-										case 1:
-										{
-											auto p = LevelData::ParseParameters<Action::Appear::_1>(data_params);
-											params = std::make_tuple
-											(
-												get_at.operator()<0, Action::Appear::_1>(p),
-												get_at.operator()<1, Action::Appear::_1>(p),
-												get_at.operator()<2, Action::Appear::_1>(p),
-												get_at.operator()<3, Action::Appear::_1>(p)
-											);
-											break;
-										}
-										case 2:
-										{
-											auto p = LevelData::ParseParameters<Action::Appear::_2>(data_params);
-											params = std::make_tuple
-											(
-												get_at.operator()<0, Action::Appear::_2>(p),
-												get_at.operator()<1, Action::Appear::_2>(p),
-												get_at.operator()<2, Action::Appear::_2>(p),
-												get_at.operator()<3, Action::Appear::_2>(p)
-											);
-											break;
-										}
-										case 3:
-										{
-											auto p = LevelData::ParseParameters<Action::Appear::_3>(data_params);
-											params = std::make_tuple
-											(
-												get_at.operator()<0, Action::Appear::_3>(p),
-												get_at.operator()<1, Action::Appear::_3>(p),
-												get_at.operator()<2, Action::Appear::_3>(p)
-											);
-											break;
-										}
-										case 4:
-										{
-											auto p = LevelData::ParseParameters<Action::Appear::_4>(data_params);
-											params = std::make_tuple
-											(
-												get_at.operator()<0, Action::Appear::_4>(p),
-												get_at.operator()<1, Action::Appear::_4>(p),
-												get_at.operator()<2, Action::Appear::_4>(p),
-												get_at.operator()<3, Action::Appear::_4>(p),
-												get_at.operator()<4, Action::Appear::_4>(p)
-											);
-											break;
-										}
-										case 5:
-										{
-											auto p = LevelData::ParseParameters<Action::Appear::_5>(data_params);
-											params = std::make_tuple
-											(
-												get_at.operator()<0, Action::Appear::_5>(p),
-												get_at.operator()<1, Action::Appear::_5>(p),
-												get_at.operator()<2, Action::Appear::_5>(p)
-											);
-											break;
-										}
-										case 6:
-										{
-											auto p = LevelData::ParseParameters<Action::Appear::_6>(data_params);
-											params = std::make_tuple
-											(
-												get_at.operator()<0, Action::Appear::_6>(p),
-												get_at.operator()<1, Action::Appear::_6>(p),
-												get_at.operator()<2, Action::Appear::_6>(p)
-											);
-											break;
-										}
-										case 7:
-										{
-											auto p = LevelData::ParseParameters<Action::Appear::_7>(data_params);
-											params = std::make_tuple
-											(
-												get_at.operator()<0, Action::Appear::_7>(p),
-												get_at.operator()<1, Action::Appear::_7>(p)
-											);
-											break;
-										}
-										default:
-										{
-											throw Error(U"`appear` overload index is invalid. (valid range: 0 ~ {})"_fmt(Action::Appear::Count - 1));
-										}
-									}
-								}
-								else if (name == U"appearFromEdge")
-								{
-									switch (overload)
-									{
-										case 0:
-										{
-											auto p = LevelData::ParseParameters<Action::AppearFromEdge::_0>(data_params);
-											params = std::make_tuple
-											(
-												get_at.operator()<0, Action::AppearFromEdge::_0>(p),
-												get_at.operator()<1, Action::AppearFromEdge::_0>(p),
-												get_at.operator()<2, Action::AppearFromEdge::_0>(p),
-												get_at.operator()<3, Action::AppearFromEdge::_0>(p),
-												get_at.operator()<4, Action::AppearFromEdge::_0>(p),
-												get_at.operator()<5, Action::AppearFromEdge::_0>(p)
-											);
-											break;
-										}
-										case 1:
-										{
-											auto p = LevelData::ParseParameters<Action::AppearFromEdge::_1>(data_params);
-											params = std::make_tuple
-											(
-												get_at.operator()<0, Action::AppearFromEdge::_1>(p),
-												get_at.operator()<1, Action::AppearFromEdge::_1>(p),
-												get_at.operator()<2, Action::AppearFromEdge::_1>(p),
-												get_at.operator()<3, Action::AppearFromEdge::_1>(p)
-											);
-											break;
-										}
-										case 2:
-										{
-											auto p = LevelData::ParseParameters<Action::AppearFromEdge::_2>(data_params);
-											params = std::make_tuple
-											(
-												get_at.operator()<0, Action::AppearFromEdge::_2>(p),
-												get_at.operator()<1, Action::AppearFromEdge::_2>(p),
-												get_at.operator()<2, Action::AppearFromEdge::_2>(p),
-												get_at.operator()<3, Action::AppearFromEdge::_2>(p)
-											);
-											break;
-										}
-										case 3:
-										{
-											auto p = LevelData::ParseParameters<Action::AppearFromEdge::_3>(data_params);
-											params = std::make_tuple
-											(
-												get_at.operator()<0, Action::AppearFromEdge::_3>(p),
-												get_at.operator()<1, Action::AppearFromEdge::_3>(p),
-												get_at.operator()<2, Action::AppearFromEdge::_3>(p)
-											);
-											break;
-										}
-										default:
-										{
-											throw Error(U"`appearFromEdge` overload index is invalid. (valid range: 0 ~ {})"_fmt(Action::AppearFromEdge::Count - 1));
-										}
-									}
-								}
-								else
-								{
-									throw Error(U"`{}` is not registered as action (method) name."_fmt(name));
-								}
-							}
-
-							// アクションデータのパース1周したら、リストに追加
-							actionDataList << LevelData::ActionData{ name, params, probability };
-						}
-					}
-					else
-					{
-						throw Error(U"`actionData` is not array type.");
-					}
+		if (not levels)
+		{
+			return;
+		}
 
-					// 1レベル走査したら、結果に追加
-					result << LevelData{ timeLimit, similarity, breedData, intervalData, actionDataList };
-				}
+		data.levels = std::move(*levels);
 
-			}
-			return result;
+		// 前のレベルデータで立てた計画は使えない
+		data.levelPlan.reset();
+		data.runPlanTask = AsyncTask<RunPlan>{};
+		data.runPlan.reset();
+
+		// レベル数が減って、進行中のレベル番号が範囲外になったら最後のレベルに寄せる
+		if ((data.levelIndex != InvalidIndex) and (data.levelIndex >= data.levels.size()))
+		{
+			data.levelIndex = data.levels.size() - 1;
+		}
+
+		// 進行中のゲームのスコアの数もレベル数に合わせる
+		if ((not data.scores.isEmpty()) and (data.scores.back().scores.size() != data.levels.size()))
+		{
+			data.scores.back().scores.resize(data.levels.size());
+		}
+
+		Score::Generic::ByLevel::SetLevelCount(data.levels.size());
+
+		// 次の起動ではキャッシュから読めるようにしておく
+		if (const Blob source{ U"level_data.json" };
+			not source.isEmpty())
+		{
+			LevelDataCache::Save(LevelDataCache::GetPath(U"level_data.json"), Util::Fnv1a(source.data(), source.size()), data.levels);
 		}
-		throw Error(U"`level_data.json is invalid format.`");
 	}
 
-	Array<Util::BackgroundData> UFOCat::LoadBackgrounds()
+	Array<Util::BackgroundData> UFOCat::LoadBackgrounds(const Util::AssetPack &assets, FilePathView directory, FilePathView manifestPath)
 	{
-		// 背景画像をイメージとして読み込む
-		auto &&bgs = FileSystem::DirectoryContents(U"texture/background").map([](const String &path) { return Image{ path }; });
-
-		// 各背景画像のピクセルの色の平均値
-		auto &&means = bgs.map([](const Image &bg)
-		{			
-			// 全てのピクセルの色をリストで返す
-			// というわけで、この map の戻り値は 各画像のピクセル配列の配列 = 二次元配列 になる
-			return bg.asArray();
-		})
-		.map([](const Array<Color> &pixels)
+		// 前回計算した平均色を読み込む
+		// 画像の内容（パックならハッシュ値、ばらばらのファイルならサイズと更新日時）が変わっていなければ、画像をデコードせずにそれを使う
+		const JSON manifest = FileSystem::IsFile(manifestPath) ? JSON::Load(manifestPath) : JSON::Invalid();
+
+		JSON updated;
+		bool isChanged = false;
+
+		// ファイル名の順に並べておくと、どの背景が何番目かが毎回同じになる
+		auto &&paths = assets.list(directory)
+			.filter([](const FilePath &path) { return FileSystem::Extension(path) == U"png"; });
+
+		auto &&backgrounds = paths.map([&](const FilePath &path)
 		{
-			// 次はそれぞれのイメージのピクセルの平均をとる
+			const String name = FileSystem::FileName(path);
+			const String fingerprint = assets.fingerprint(path);
 
-			// 各チャンネルの和を入れる
-			uint32 sumR = 0;
-			uint32 sumG = 0;
-			uint32 sumB = 0;
+			ColorF mean;
 
-			for (auto &&pixel : pixels) {
-				sumR += pixel.r;
-				sumG += pixel.g;
-				sumB += pixel.b;
+			if (manifest
+				and manifest.hasElement(name)
+				and (manifest[name][U"fingerprint"].getString() == fingerprint))
+			{
+				mean = ColorF{ manifest[name][U"mean"][0].get<double>(), manifest[name][U"mean"][1].get<double>(), manifest[name][U"mean"][2].get<double>() };
+			}
+			else
+			{
+				// 変わっていればデコードして計算し直す
+				mean = Util::MeanColor(assets.loadImage(path));
+				isChanged = true;
 			}
 
-			// ピクセル数で割って平均化
-			const auto &[aveR, aveG, aveB] = Vec3{ sumR, sumG, sumB } / pixels.size();
+			updated[name][U"fingerprint"] = fingerprint;
+			updated[name][U"mean"] = Array<double>{ mean.r, mean.g, mean.b };
 
-			// もとの色は Color なので 和を平均化すると 0 ~ 255 の値にになっているはず
-			// それをさらに 255 で割って 0 ~ 1 に正規化
-			return ColorF{ aveR / 255, aveG / 255, aveB / 255 };
+			// 平均色をモノクロ -> 色反転 したらだいたい反対の色になって見やすくなる
+			// テクスチャはシーンで選ばれたときに `loaded()` で読み込む
+			return Util::BackgroundData{ path, ColorF{ 1.0 - mean.grayscale() } };
 		});
 
-		// イメージと色のリスト2つに対して並列にループ
-		return Range(0, bgs.size() - 1).map([&](size_t i)
+		// 消えた背景があったときも書き直す
+		if (isChanged or (not manifest) or (manifest.size() != updated.size()))
 		{
-			// 平均色をモノクロ -> 色反転 したらだいたい反対の色になって見やすくなる
-			const ColorF inversed{ 1.0 - means[i].grayscale() };
+			updated.saveMinimum(manifestPath);
+		}
 
-			return Util::BackgroundData{ Texture{ bgs[i] }, inversed };
-		});
+		return backgrounds;
 	}
 }
 
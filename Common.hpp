@@ -2,29 +2,53 @@
 # include "GUI.hpp"
 # include "CatObject.hpp"
 # include "LevelData.hpp"
+# include "SimilarityMatrix.hpp"
+# include "LevelPlan.hpp"
+# include "RunPlan.hpp"
+# include "LevelDataCache.hpp"
+# include "LevelDataWatcher.hpp"
 # include "AudioSource.hpp"
+# include "InputQueue.hpp"
+# include "CatTextureResidency.hpp"
+# include "ImageMean.hpp"
+# include "AssetPack.hpp"
+# include "SoundEffectCache.hpp"
+# include "AudioQueue.hpp"
+# include "CatVoicePool.hpp"
+# include "GlyphCache.hpp"
 
 using namespace UFOCat::Core;
 
 namespace UFOCat
 {
 	/// @brief インデックスを保存する変数のための無効値 @n
-	/// このゲームで登場するUFO猫の種類は最大で 44 種類であり、
-	/// テクスチャを読み込む際も、レベルデータを読み込む際も、その数字を超えることはない @n
-	/// そのため、この名前空間内では特別に無効値として扱う
+	/// UFO猫の種類はカタログを追加すれば増えるので、実際のインデックスにはなりえない `size_t` の最大値を使う
 	/// @note Optional でもよかったけど、いちいち value() ってするのが面倒だったけん
-	constexpr size_t InvalidIndex = 44;
+	constexpr size_t InvalidIndex = std::numeric_limits<size_t>::max();
 
 	namespace Util
 	{
 		/// @brief 背景画像のデータ
 		struct BackgroundData
 		{
-			/// @brief テクスチャデータ
-			Texture texture;
+			/// @brief 画像ファイルの論理パス
+			FilePath path;
 
 			/// @brief この背景の上に描画するものに対して使用するとちょうどよくなる影の色
 			ColorF shadowColor;
+
+			/// @brief テクスチャデータ
+			/// @note `LoadBackgrounds()` の時点では空で、シーンで選んだときに `loaded()` で読み込む
+			Texture texture;
+
+			/// @brief テクスチャを読み込んだ状態のコピーを取得する
+			/// @param assets 画像を読み込む元
+			/// @return テクスチャを読み込んだ背景データ
+			/// @note 読み込んだテクスチャはコピーを持っているシーンが終わると解放される
+			BackgroundData loaded(const AssetPack &assets) const
+			{
+				return BackgroundData{ path, shadowColor, texture ? texture : assets.loadTexture(path) };
+			}
 		};
 	}
 
@@ -34,6 +58,8 @@ namespace UFOCat
 
 		enum class State
 		{
+			/// @brief 起動時の読み込み画面
+			Boot,
 			/// @brief タイトル画面
 			Title,
 			/// @brief 捕まえるUFO猫が発表される画面 レベルシーンの初期化処理に使う
@@ -99,18 +125,29 @@ namespace UFOCat
 					size_t calculateTotal();
 
 					/// @brief このゲームでの理論上の最大スコアを返す
-					/// @remarks アプリが起動している間、変更されないレベル数をもとに計算されるので、引数を省略可能とする @n
-					/// この計算は、レベルデータがアプリが最初に起動したときにのみ読み込まれる保証を利用している
-					/// @param levelCount レベル数 省略された場合はアプリ起動時に設定されたレベル数が使われる
+					/// @remarks `SetLevelCount()` で設定されたレベル数での値は計算済みのものを返すので、引数を省略可能とする
+					/// @param levelCount レベル数 省略された場合は `SetLevelCount()` で設定されたレベル数が使われる
 					/// @return 理論値
 					static size_t GetMaxTheoretical(size_t levelCount = 0);
 
 					/// @brief この1ゲームで行われる最大レベル数を決める @n
 					/// 単純に level_data.json で定義されたレベルの数と同じだが、
 					/// レベルの数をもとに最大スコアの理論値が決まるため、ここで保持しておき、
-					/// アプリが起動している間、変更を許さない
+					/// レベル数が変わったとき（`level_data.json` のホットリロードなど）だけ理論値を計算し直す
 					/// @param count レベル数
 					static void SetLevelCount(size_t count);
+
+				private:
+					/// @brief 指定したレベル数での理論上の最大スコアを計算する
+					/// @param levelCount レベル数
+					/// @return 理論値
+					static size_t ComputeMaxTheoretical(size_t levelCount);
+
+					/// @brief `SetLevelCount()` で設定されたレベル数
+					inline static size_t m_levelCount = 0;
+
+					/// @brief `m_levelCount` での理論上の最大スコア
+					inline static size_t m_maxTheoretical = 0;
 				};
 
 				/// @brief 各レベルのスコアデータ
@@ -147,6 +184,12 @@ namespace UFOCat
 			/// @brief 使用する全てのUFO猫のデータ
 			Array<std::shared_ptr<CatData>> cats;
 
+			/// @brief 全てのUFO猫同士の類似度の表（`cats` を読み込んだときに作る）
+			SimilarityMatrix similarities;
+
+			/// @brief 全てのUFO猫のピクセル単位の当たり判定マスク（インデックスは `cats` での位置 = `CatData::index` と同じで、ID ではない）
+			Array<std::shared_ptr<const AlphaMask>> hitMasks;
+
 			/// @brief 使用する全てのレベルデータ
 			Array<LevelData> levels;
 
@@ -162,14 +205,59 @@ namespace UFOCat
 			/// @brief 現在BGMとして再生しているオーディオの名前（1 つのみ）
 			String bgmName;
 
-			/// @brief 現在のターゲットの ID（= インデックスと同義）を格納する変数
-			size_t targetId = InvalidIndex;
+			/// @brief 現在のターゲットの `cats` でのインデックスを格納する変数
+			/// @note カタログ上の ID とは一致しないので、テクスチャには `cats[targetIndex]->id` を使う
+			size_t targetIndex = InvalidIndex;
 
 			/// @brief 現在のレベルのインデックスを格納する変数
 			size_t levelIndex = InvalidIndex;
 
+			/// @brief 次のレベルの計画 `Wanted` シーンで作り、`Level` シーンで使う
+			/// @note レベルデータが差し替えられたら作り直すので `none` に戻す
+			Optional<LevelPlan> levelPlan;
+
+			/// @brief 1プレイ分の計画を立てている処理 タイトルで「あそぶ」が押されたときに始める
+			AsyncTask<RunPlan> runPlanTask;
+
+			/// @brief 1プレイ分の計画 `Wanted` シーンで `runPlanTask` から受け取る
+			/// @note レベルデータが差し替えられたら作り直すので `none` に戻す
+			Optional<RunPlan> runPlan;
+
+			/// @brief 画像を読み込む元 リリースビルドでは `assets.pack` があればそれを、なければばらばらのファイルを使う
+			Util::AssetPack assets;
+
+			/// @brief UFO猫のテクスチャの読み込みと解放の管理 @n
+			/// 読み込んだままにするテクスチャの数を抑えるので、カタログが大きくなってもメモリ使用量は増えない
+			Util::CatTextureResidency catTextures;
+
+			/// @brief 効果音の読み込みと解放の管理 @n
+			/// 効果音は使う直前のシーンで読み込み始め、予算を超えたら使っていないものから解放する
+			Util::SoundEffectCache soundEffects;
+
+			/// @brief 音の操作のキュー シーンからはここに操作を出し、フレームの終わりにまとめて実行する
+			Util::AudioQueue audio;
+
+			/// @brief UFO猫の鳴き声のミキサー 猫が何匹いても同時に鳴らすのはボイスの数までにする
+			Util::CatVoicePool catVoices;
+
 			/// @brief グローバルタイマー @n 色んな場所で使いまわす
 			Timer timer;
+
+			/// @brief フレームより細かい時刻でクリックを記録する入力キュー
+			/// @note `Main()` のループで毎フレーム `update()` される
+			Util::InputQueue input;
+
+			/// @brief `level_data.json` の変更の監視 @n
+			/// 変更されたら `ApplyLevelDataChanges()` でフレームの合間に `levels` を差し替える
+			LevelDataWatcher levelWatcher;
+
+			/// @brief 起動した時刻 [us] (`Time::GetMicrosec()` 基準) @n
+			/// タイトルが初めて操作できるようになるまでの時間を計測したら 0 にする
+			uint64 bootStartTime = 0;
+
+			/// @brief レベルシーンの途中かどうか
+			/// @note レベルの途中ではそのレベルのデータを使い続けるので、`levels` の差し替えを待つ
+			bool isPlayingLevel = false;
 		};
 	}
 
@@ -194,13 +282,37 @@ namespace UFOCat
 	/// @return 全てのUFO猫のインスタンスリスト
 	Array<CatData> LoadCatData();
 
-	/// @brief 各フェーズのデータをJSONから読み込んでそれらすべてのインスタンスを作成する
+	/// @brief 全てのUFO猫のテクスチャ画像から、ピクセル単位の当たり判定マスクを作成する
+	/// @param cats 全てのUFO猫のデータ
+	/// @param textures 画像ファイルを登録済みのテクスチャ管理
+	/// @return 全てのUFO猫のマスクのリスト（インデックスは `cats` と同じ）
+	Array<std::shared_ptr<const AlphaMask>> LoadHitMasks(const Array<std::shared_ptr<CatData>> &cats, const Util::CatTextureResidency &textures);
+
+	/// @brief 各フェーズのデータを読み込んでそれらすべてのインスタンスを作成する @n
+	/// JSON の隣にあるキャッシュ（`LevelDataCache`）が JSON の内容と一致していればそれを読み込み、
+	/// なければ JSON をパースして、成功したらキャッシュを書き出す
+	/// @param path JSON ファイルのパス
 	/// @return 全てのフェーズのリスト
-	Array<LevelData> LoadLevelData();
+	Array<LevelData> LoadLevelData(FilePathView path = U"level_data.json");
 
-	/// @brief 使用する背景画像を読み込んでそれら全てのテクスチャと影の色のペアを作成する
-	/// @return 全ての背景画像のテクスチャと使用する影の色のペアのリスト
-	Array<Util::BackgroundData> LoadBackgrounds();
+	/// @brief 各フェーズのデータをJSONからパースしてそれらすべてのインスタンスを作成する（キャッシュは使わない）
+	/// @param json `level_data.json` の形式の JSON
+	/// @return 全てのフェーズのリスト
+	Array<LevelData> ParseLevelData(const JSON &json);
+
+	/// @brief `level_data.json` が変更されていれば、変更されたレベルだけパースし直して `levels` を差し替える @n
+	/// レベル数が変わったときは、進行中のレベル番号やスコアの数、スコアの理論値も合わせる
+	/// @param data ゲーム全体で共有するデータ
+	/// @remarks `Main()` のループで、シーンの更新より前に毎フレーム呼び出す レベルシーンの途中では何もしない
+	void ApplyLevelDataChanges(GameData &data);
+
+	/// @brief 使用する背景画像を調べて、それぞれの影の色を決める @n
+	/// 影の色のもとになる平均色はマニフェストに保存しておき、画像が変わっていなければ画像をデコードせずに使う
+	/// @param assets 画像を読み込む元
+	/// @param directory 背景画像のフォルダの論理パス
+	/// @param manifestPath 平均色を保存しておくマニフェストのパス
+	/// @return 全ての背景画像のパスと使用する影の色のペアのリスト（テクスチャはまだ読み込まない）
+	Array<Util::BackgroundData> LoadBackgrounds(const Util::AssetPack &assets, FilePathView directory = U"texture/background", FilePathView manifestPath = U"texture/background.manifest.json");
 
 	using App = SceneManager<State, GameData>;
 }
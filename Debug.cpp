@@ -0,0 +1,181 @@
+﻿# include "Debug.hpp"
+
+# if _DEBUG
+
+namespace
+{
+	using namespace UFOCat;
+	using namespace UFOCat::Core;
+
+	/// @brief 各計測を何回繰り返すか（一番速かったものを採用する）
+	constexpr size_t Trials = 3;
+
+	/// @brief 処理を `Trials` 回繰り返して、一番速かった時間を計測する
+	/// @param func 計測する処理
+	/// @return 一番速かった時間 [ms]
+	double Measure(auto &&func)
+	{
+		double best = Inf<double>;
+
+		for (size_t i = 0; i < Trials; ++i)
+		{
+			const s3d::Stopwatch watch{ StartImmediately::Yes };
+			func();
+			best = Min(best, watch.msF());
+		}
+
+		return best;
+	}
+
+	/// @brief `level_data.json` のレベルを順番に繰り返して、合成データの JSON 文字列を作る
+	/// @param levelCount 合成データのレベル数
+	/// @return JSON 文字列 `level_data.json` が読めなければ `none`
+	Optional<String> MakeSyntheticLevelData(size_t levelCount)
+	{
+		const JSON source = JSON::Load(U"level_data.json");
+
+		if ((not source) or (not source[U"data"].isArray()) or source[U"data"].size() == 0)
+		{
+			Logger << U"[Benchmark] `level_data.json` is not available.";
+			return none;
+		}
+
+		const Array<String> originals = source[U"data"].arrayView().map([](const JSON &level) { return level.formatMinimum(); });
+		Array<String> levels(Arg::reserve = levelCount);
+
+		for (size_t i = 0; i < levelCount; ++i)
+		{
+			levels << originals[i % originals.size()];
+		}
+
+		return U"{\"data\":[" + levels.join(U",", U"", U"") + U"]}";
+	}
+}
+
+namespace UFOCat::Debug
+{
+	void BenchmarkLevelData(size_t levelCount)
+	{
+		const auto synthetic = MakeSyntheticLevelData(levelCount);
+
+		if (not synthetic)
+		{
+			return;
+		}
+
+		const FilePath path = FileSystem::TemporaryDirectoryPath() + U"UFOCat/level_data_benchmark.json";
+		const FilePath cachePath = LevelDataCache::GetPath(path);
+
+		TextWriter{ path }.write(*synthetic);
+		FileSystem::Remove(cachePath);
+
+		// JSON: ファイルの読み込み + パース
+		const double jsonMs = Measure([&]() { ParseLevelData(JSON::Load(path)); });
+
+		// 1回読み込んでキャッシュを作っておく
+		LoadLevelData(path);
+		const int64 cacheBytes = FileSystem::FileSize(cachePath);
+
+		// キャッシュ: ハッシュ値の計算 + メモリマップでの読み込み
+		const double cacheMs = Measure([&]() { LoadLevelData(path); });
+
+		Logger << U"[Benchmark] {} levels: JSON {:.1f}ms / cache {:.1f}ms (x{:.1f}), JSON {} bytes / cache {} bytes"_fmt(
+			levelCount, jsonMs, cacheMs, jsonMs / cacheMs, FileSystem::FileSize(path), cacheBytes);
+
+		FileSystem::Remove(path);
+		FileSystem::Remove(cachePath);
+	}
+
+	void BenchmarkActionParser(size_t levelCount)
+	{
+		const auto synthetic = MakeSyntheticLevelData(levelCount);
+
+		if (not synthetic)
+		{
+			return;
+		}
+
+		// JSON 自体のパースは計測に含めない
+		const JSON json = JSON::Parse(*synthetic);
+
+		// 全てのアクションのパラメータを、指定したパーサーでパースする
+		const auto parseAll = [&json](auto &&parse)
+		{
+			Array<Action::Generic> result;
+
+			for (const auto &level : json[U"data"].arrayView())
+			{
+				for (const auto &action : level[U"actionData"].arrayView())
+				{
+					result << parse(action[U"name"].getString(), action[U"overload"].get<size_t>(), action[U"params"]);
+				}
+			}
+
+			return result;
+		};
+
+		const auto tableParse = [](const String &name, size_t overload, const JSON &params) { return LevelData::ParseAction(name, overload, params); };
+
+		const double tableMs = Measure([&]() { parseAll(tableParse); });
+		const size_t actionCount = parseAll(tableParse).size();
+
+		Logger << U"[Benchmark] {} actions: {:.1f}ms ({:.3f}us / action)"_fmt(
+			actionCount, tableMs, (actionCount == 0) ? 0.0 : (tableMs * 1000.0 / actionCount));
+	}
+
+	void BuildAssetPack(FilePathView output)
+	{
+		const s3d::Stopwatch watch{ StartImmediately::Yes };
+
+		if (not Util::AssetPack::Build(output, { U"texture" }))
+		{
+			Logger << U"[AssetPack] Failed to build `{}`"_fmt(output);
+			return;
+		}
+
+		Logger << U"[AssetPack] `{}`: {:.1f}MiB in {:.1f}ms"_fmt(output, FileSystem::FileSize(output) / (1024.0 * 1024.0), watch.msF());
+	}
+
+	void StressCatVoices(const Util::SoundEffectCache &soundEffects, size_t spawnCount)
+	{
+		// 60fps で 10秒 分のフレームを再現する
+		constexpr size_t Frames = 600;
+
+		for (const size_t count : { size_t{ 10 }, spawnCount / 10, spawnCount })
+		{
+			Util::CatVoicePool pool;
+			pool.load(soundEffects, { Util::AudioSource::SE::Cat01, Util::AudioSource::SE::Cat02 });
+			pool.setVolume(0.0);
+
+			const Vec2 listener = Scene::Center();
+			const double startTime = Scene::Time();
+			size_t maxActive = 0;
+			double maxMs = 0.0;
+
+			const s3d::Stopwatch total{ StartImmediately::Yes };
+
+			for (size_t frame = 0; frame < Frames; ++frame)
+			{
+				const double time = startTime + frame / 60.0;
+				const s3d::Stopwatch watch{ StartImmediately::Yes };
+
+				for (size_t i = 0; i < count; ++i)
+				{
+					pool.request(RandomBool() ? Util::AudioSource::SE::Cat01 : Util::AudioSource::SE::Cat02, RandomVec2(Scene::Rect()), listener);
+				}
+
+				pool.update(listener, time);
+
+				maxMs = Max(maxMs, watch.msF());
+				maxActive = Max(maxActive, pool.activeCount(time));
+			}
+
+			pool.stopAll();
+
+			Logger << U"[Benchmark] {} cats: {:.3f}ms/frame (max {:.3f}ms), max {} voices, started {} / stolen {} / dropped {}"_fmt(
+				count, total.msF() / Frames, maxMs, maxActive, pool.stats().started, pool.stats().stolen, pool.stats().dropped);
+		}
+	}
+}
+
+# endif
@@ -0,0 +1,29 @@
+﻿# pragma once
+# include "Common.hpp"
+
+# if _DEBUG
+
+/// @brief デバッグビルドでのみ使う計測機能など
+namespace UFOCat::Debug
+{
+	/// @brief `level_data.json` のレベルを繰り返して指定した数のレベルを持つ合成データを作り、
+	/// JSON をパースする場合とキャッシュを読み込む場合の読み込み時間を比較して `Logger` に出力する
+	/// @param levelCount 合成データのレベル数
+	void BenchmarkLevelData(size_t levelCount = 10000);
+
+	/// @brief 合成データの全てのアクションについて、`LevelData::ParseAction()` でのパラメータのパース時間を計測して `Logger` に出力する
+	/// @param levelCount 合成データのレベル数
+	void BenchmarkActionParser(size_t levelCount = 10000);
+
+	/// @brief `texture` フォルダの中身をまとめたアセットパックを作り、サイズとかかった時間を `Logger` に出力する
+	/// @param output 書き込み先のパス
+	void BuildAssetPack(FilePathView output = U"assets.pack");
+
+	/// @brief 毎フレーム全ての猫が鳴こうとする状況を、猫の数を変えて無音で再現し、
+	/// 鳴き声のミキサーの1フレームあたりの処理時間と、同時に鳴っていたボイスの最大数を `Logger` に出力する
+	/// @param soundEffects 効果音を読み込む元
+	/// @param spawnCount 一番多いときの猫の数
+	void StressCatVoices(const Util::SoundEffectCache &soundEffects, size_t spawnCount = 1000);
+}
+
+# endif
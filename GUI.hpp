@@ -5,6 +5,60 @@
 
 namespace UFOCat::GUI
 {
+	/// @brief GUI コンポーネントのレイアウト計算（テキストの計測や領域の再計算）が行われた回数を数える @n
+	/// コンポーネントは一度設定したプロパティを保持し、値が変わったときだけレイアウトしなおすので、
+	/// 何も変わっていないフレームでは 0 になるはず
+	class LayoutCounter
+	{
+	private:
+		struct State
+		{
+			/// @brief 今のフレームでの回数
+			size_t current = 0;
+
+			/// @brief 直前のフレームでの回数
+			size_t last = 0;
+
+			/// @brief 起動してからの合計
+			size_t total = 0;
+		};
+
+		static State &m_state() noexcept
+		{
+			static State state;
+			return state;
+		}
+
+	public:
+		/// @brief レイアウト計算を 1回 行ったことを記録する
+		static void Add() noexcept
+		{
+			++m_state().current;
+			++m_state().total;
+		}
+
+		/// @brief フレームを進める 毎フレーム、シーンの更新のあとに 1度 呼び出す
+		static void NextFrame() noexcept
+		{
+			m_state().last = m_state().current;
+			m_state().current = 0;
+		}
+
+		/// @brief 直前のフレームでのレイアウト計算の回数を取得する
+		/// @return 回数
+		static size_t LastFrame() noexcept
+		{
+			return m_state().last;
+		}
+
+		/// @brief 起動してからのレイアウト計算の回数を取得する
+		/// @return 回数
+		static size_t Total() noexcept
+		{
+			return m_state().total;
+		}
+	};
+
 	/// @brief 描画可能コンポーネントのインターフェース
 	/// @note 正確にはメンバーを持つのでインターフェースではないけど
 	class IDrawable
@@ -231,16 +285,22 @@ namespace UFOCat::GUI
 	{
 		Font m_font = FontAsset(Util::FontFamily::YuseiMagic);
 
-		double m_fontSize;
+		double m_fontSize = 0.0;
 
 		String m_text;
 
-		Audio m_se = AudioAsset(Util::AudioSource::SE::Open);
+		/// @brief ボタンを押したときに鳴らす効果音のアセット名
+		/// @note `Audio` を持っていると `SoundEffectCache::trim()` で解放できなくなるので、名前だけを持ち、鳴らすときに引く
+		AssetName m_se = Util::AudioSource::SE::Open;
 
 		bool m_isEnabled = true;
 
 		Vec2 m_padding = { 30.0, 10.0 };
 
+		/// @brief テキストを計測しなおして、パディング分を足した大きさに領域を合わせる
+		/// @note 左上の位置はそのまま保つ
+		void m_layout();
+
 	public:
 
 		/// @brief デフォルトコンストラクタ
@@ -251,21 +311,21 @@ namespace UFOCat::GUI
 		/// @param font テキストに使うフォント
 		/// @param fontSize フォントサイズ
 		/// @param text テキスト
-		/// @param se ボタンを押したときに鳴らす効果音
+		/// @param se ボタンを押したときに鳴らす効果音のアセット名
 		/// @param positionType 座標指定方法
 		/// @param isEnabled 有効かどうか
 		/// @param padding ボタンの内側余白 (デフォルトは (30, 10))
 		/// @note https://siv3d.github.io/ja-jp/tutorial2/button/ を参考に改変
-		Button(const Font &font, double fontSize, const String &text, const Audio &se, PositionType positionType = PositionType::Absolute, bool isEnabled = true, const Vec2 &padding = { 30.0, 10.0 });
+		Button(const Font &font, double fontSize, const String &text, AssetNameView se, PositionType positionType = PositionType::Absolute, bool isEnabled = true, const Vec2 &padding = { 30.0, 10.0 });
 
 		/// @brief コンストラクタ（フォントはデフォルト）
 		/// @param fontSize フォントサイズ
 		/// @param text テキスト
-		/// @param se ボタンを押したときに鳴らす効果音
+		/// @param se ボタンを押したときに鳴らす効果音のアセット名
 		/// @param positionType 座標指定方法
 		/// @param isEnabled 有効かどうか
 		/// @param padding ボタンの内側余白 (デフォルトは (30, 10))
-		Button(double fontSize, const String& text, const Audio& se, PositionType positionType = PositionType::Absolute, bool isEnabled = true, const Vec2& padding = { 30.0, 10.0 });
+		Button(double fontSize, const String& text, AssetNameView se, PositionType positionType = PositionType::Absolute, bool isEnabled = true, const Vec2& padding = { 30.0, 10.0 });
 
 		/// @brief コンストラクタ（SE はデフォルト）
 		/// @param font テキストに使うフォント
@@ -276,24 +336,25 @@ namespace UFOCat::GUI
 		/// @param padding ボタンの内側余白 (デフォルトは (30, 10))
 		Button(const Font& font, double fontSize, const String& text, PositionType positionType = PositionType::Absolute, bool isEnabled = true, const Vec2& padding = { 30.0, 10.0 });
 
-		/// @brief ボタンの各種パラメータを一括で設定する
+		/// @brief ボタンの各種パラメータを一括で設定する @n
+		/// 見た目の大きさに関わる値（フォント、フォントサイズ、テキスト、余白）が変わったときだけ計測しなおす
 		/// @param font テキストに使うフォント
 		/// @param fontSize フォントサイズ
 		/// @param text テキスト
-		/// @param se ボタンを押したときに鳴らす効果音
+		/// @param se ボタンを押したときに鳴らす効果音のアセット名
 		/// @param positionType 座標指定方法
 		/// @param isEnabled 有効かどうか
 		/// @param padding ボタンの内側余白 (デフォルトは (30.0, 10.0))
-		Button &set(const Font &font, double fontSize, const String &text, const Audio &se, PositionType positionType = PositionType::Absolute, bool isEnabled = true, const Vec2 &padding = { 30.0, 10.0 });
+		Button &set(const Font &font, double fontSize, const String &text, AssetNameView se, PositionType positionType = PositionType::Absolute, bool isEnabled = true, const Vec2 &padding = { 30.0, 10.0 });
 
 		/// @brief ボタンの各種パラメータを一括で設定する（フォントはデフォルト）
 		/// @param fontSize フォントサイズ
 		/// @param text テキスト
-		/// @param se ボタンを押したときに鳴らす効果音
+		/// @param se ボタンを押したときに鳴らす効果音のアセット名
 		/// @param positionType 座標指定方法
 		/// @param isEnabled 有効かどうか
 		/// @param padding ボタンの内側余白 (デフォルトは (30.0, 10.0))
-		Button &set(double fontSize, const String& text, const Audio& se, PositionType positionType = PositionType::Absolute, bool isEnabled = true, const Vec2& padding = { 30.0, 10.0 });
+		Button &set(double fontSize, const String& text, AssetNameView se, PositionType positionType = PositionType::Absolute, bool isEnabled = true, const Vec2& padding = { 30.0, 10.0 });
 
 		/// @brief ボタンの各種パラメータを一括で設定する（SE はデフォルト）
 		/// @param font テキストに使うフォント
@@ -323,6 +384,11 @@ namespace UFOCat::GUI
 		/// @return 
 		Button& setText(const String& text);
 
+		/// @brief ボタンの有効 / 無効を切り替える
+		/// @param isEnabled 有効かどうか
+		/// @return 自分自身の参照
+		Button &setEnabled(bool isEnabled) noexcept;
+
 		inline RelocatableTypeID typeID() const override { return RelocatableTypeID::Button; }
 
 		inline Button& setPosition(const Vec2& position, bool isOverwriteDefault = false) noexcept override
@@ -410,7 +476,8 @@ namespace UFOCat::GUI
 
 		ProgressBar(const SizeF& size, ColorF color, PositionType positionType = PositionType::Absolute, double roundness = 9.0, double progress = 0.0);
 
-		/// @brief 各パラメータを設定する
+		/// @brief 各パラメータを設定する @n
+		/// 大きさが変わったときだけ領域を作りなおす
 		/// @param size プログレスバーの背景領域の大きさ
 		/// @param color バーの色
 		/// @param positionType 座標指定方法
@@ -495,11 +562,24 @@ namespace UFOCat::GUI
 		DrawableText m_text;
 
 		/// @brief フォントサイズ
-		double m_fontSize;
+		double m_fontSize = 0.0;
 
 		/// @brief テキストの色
 		Color m_color;
 
+		/// @brief 折り返したあとの各行 @n
+		/// 毎フレーム `String` と `DrawableText` を作らないよう、描ける形で持っておく
+		Array<DrawableText> m_lines;
+
+		/// @brief `m_lines` を計算したときの横幅 まだ計算していなければ `none`
+		/// @note 折り返していない状態は `Math::Inf`
+		Optional<double> m_layoutWidth;
+
+		/// @brief 横幅に合わせてテキストを折り返す位置を決め、`m_lines` に保存する @n
+		/// `DrawableText::draw(fontSize, RectF, color)` と同じく、幅を越える文字の手前と改行文字で折り返す
+		/// @param width 折り返す横幅
+		void m_layout(double width);
+
 	public:
 		TextBox() = default;
 
@@ -585,7 +665,8 @@ namespace UFOCat::GUI
 		/// @return 
 		TextBox &setIndent(double px);
 
-		/// @brief 指定した横幅に合わせてテキストボックスの折り返しと高さ変更をする
+		/// @brief 指定した横幅に合わせてテキストボックスの折り返しと高さ変更をする @n
+		/// 折り返し位置は横幅、テキスト、フォントサイズが変わったときだけ計算しなおす
 		/// @param width 合わせる横幅
 		/// @return テキストボックスの範囲が変化すれば true
 		bool adjustWidth(double width);
@@ -630,9 +711,37 @@ namespace UFOCat::GUI
 		/// @brief スクロールバー
 		ScrollData m_bar;
 
+		/// @brief コンテンツ1つ分の縦方向の範囲（スクロールが 0 の状態での座標）
+		struct Bound
+		{
+			/// @brief 上端の Y 座標
+			double top;
+
+			/// @brief 下端の Y 座標
+			double bottom;
+
+			/// @brief 先頭からこの要素までの下端の Y 座標の最大値
+			/// @note 上端の順に並べても下端の順にはなるとは限らないので、二分探索にはこっちを使う
+			double maxBottom;
+
+			/// @brief `m_contents` でのインデックス
+			size_t index;
+		};
+
 		/// @brief 中に入れておくコンポーネント
+		/// @note スクロールしても各コンポーネントは動かさず、描画するときにインナーの分だけずらす
 		Array<std::unique_ptr<Relocatable>> m_contents{};
 
+		/// @brief 各コンテンツの縦方向の範囲を、上端の Y 座標の順に並べたもの
+		Array<Bound> m_bounds;
+
+		/// @brief インナー要素全体を描いておくテクスチャ
+		/// @note インナーが高すぎるときは作らず、見えている要素だけを毎フレーム描画する
+		RenderTexture m_canvas;
+
+		/// @brief `m_canvas` を描きなおす必要があるか
+		bool m_isDirty = true;
+
 		/// @brief 現在のスクロール割合 (0.0 ~ 1.0)
 		double m_progress = 0.0;
 
@@ -640,6 +749,9 @@ namespace UFOCat::GUI
 		/// @note バーの色を変えるときに使う
 		bool m_isHoverBar = false;
 
+		/// @brief `m_canvas` を作る上限の高さ
+		constexpr static int32 m_MaxCanvasHeight = 4096;
+
 	public:
 		/// @brief スクロールバーのサイズ
 		constexpr static SizeF BarSize{ 5, 60 };
@@ -670,6 +782,17 @@ namespace UFOCat::GUI
 		/// @brief コンテンツの高さや位置を更新する
 		void m_updateContents();
 
+		/// @brief `m_bounds` を作りなおし、テクスチャを描きなおすようにする
+		void m_updateBounds();
+
+		/// @brief インナー要素全体をテクスチャに描く
+		void m_render();
+
+		/// @brief 指定した縦方向の範囲に少しでもかかるコンテンツだけを描画する
+		/// @param top 範囲の上端（スクロールが 0 の状態での座標）
+		/// @param bottom 範囲の下端（スクロールが 0 の状態での座標）
+		void m_drawContents(double top, double bottom) const;
+
 	public:
 
 		Scrollable() = default;
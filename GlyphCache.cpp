@@ -0,0 +1,119 @@
+﻿# include "GlyphCache.hpp"
+
+namespace UFOCat::Util
+{
+	GlyphCache::State &GlyphCache::m_state()
+	{
+		static State state;
+		return state;
+	}
+
+	void GlyphCache::AddBasic()
+	{
+		String text;
+
+		// ASCII の表示できる文字
+		for (char32 c = U' '; c <= U'~'; ++c)
+		{
+			text << c;
+		}
+
+		// ひらがな、カタカナ
+		for (char32 c = U'ぁ'; c <= U'ゖ'; ++c)
+		{
+			text << c;
+		}
+
+		for (char32 c = U'ァ'; c <= U'ヺ'; ++c)
+		{
+			text << c;
+		}
+
+		text += U"ー、。「」『』（）！？…・★■　";
+
+		Add(text);
+	}
+
+	bool GlyphCache::Load(FilePathView path)
+	{
+		TextReader reader{ path };
+
+		if (not reader)
+		{
+			return false;
+		}
+
+		// 読み込んだ文字はすでに保存されているので、保存し直す必要はない
+		const bool isDirty = m_state().isDirty;
+		Add(reader.readAll());
+		m_state().isDirty = isDirty;
+
+		return true;
+	}
+
+	void GlyphCache::Add(StringView text)
+	{
+		auto &state = m_state();
+
+		for (const char32 c : text)
+		{
+			// 改行などはグリフがいらない
+			if (IsControl(c) or (not state.known.emplace(c).second))
+			{
+				continue;
+			}
+
+			state.pending << c;
+			state.isDirty = true;
+		}
+	}
+
+	size_t GlyphCache::Prewarm(const Duration &budget)
+	{
+		auto &state = m_state();
+		const s3d::Stopwatch watch{ StartImmediately::Yes };
+
+		while ((not state.pending.isEmpty()) and (watch.elapsed() < budget))
+		{
+			const String chunk = state.pending.substr(0, m_ChunkSize);
+
+			for (const auto &family : m_Families)
+			{
+				FontAsset(family).preload(chunk);
+			}
+
+			state.pending.erase(0, chunk.size());
+		}
+
+		return state.pending.size();
+	}
+
+	size_t GlyphCache::Remaining() noexcept
+	{
+		return m_state().pending.size();
+	}
+
+	bool GlyphCache::Save(FilePathView path)
+	{
+		auto &state = m_state();
+
+		if (not state.isDirty)
+		{
+			return true;
+		}
+
+		FileSystem::CreateDirectories(FileSystem::ParentPath(path));
+		TextWriter writer{ path };
+
+		if (not writer)
+		{
+			return false;
+		}
+
+		// 並びを揃えておくと、差分が見やすい
+		writer.write(String(state.known.begin(), state.known.end()).sort());
+		state.isDirty = false;
+
+		return true;
+	}
+}
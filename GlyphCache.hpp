@@ -0,0 +1,68 @@
+﻿# pragma once
+# include "FontFamily.hpp"
+
+namespace UFOCat::Util
+{
+	/// @brief ゲームで使う文字のグリフを、初めて描画する前に作っておくための管理クラス @n
+	/// SDF のグリフは初めて描画する文字ごとにその場で作られるので、長い日本語の文章を初めて出すフレームが重くなる @n
+	/// 使った文字の一覧をファイルに保存しておき、次回からは起動時の読み込み画面の間にまとめてグリフを作る
+	/// @note フォントアセットと同じくゲーム全体で1つなので、静的メンバだけを持つ
+	class GlyphCache
+	{
+	private:
+		/// @brief 文字の一覧と、まだグリフを作っていない文字
+		struct State
+		{
+			/// @brief 一度でも追加された文字
+			HashSet<char32> known;
+
+			/// @brief まだグリフを作っていない文字
+			String pending;
+
+			/// @brief 保存してから新しい文字が追加されたかどうか
+			bool isDirty = false;
+		};
+
+		/// @brief グリフを作るフォントアセットの名前
+		inline static const std::array<String, 2> m_Families = { FontFamily::YuseiMagic, FontFamily::KoharuiroSunray };
+
+		/// @brief 1度にグリフを作る文字数 予算の確認はこの単位で行う
+		constexpr static size_t m_ChunkSize = 8;
+
+		/// @brief 状態を取得する
+		/// @return 状態
+		static State &m_state();
+
+	public:
+		/// @brief 文字の一覧を保存するファイルの既定のパス
+		constexpr static StringView DefaultPath = U"cache/glyphs.txt";
+
+		/// @brief ASCII とひらがな・カタカナ、よく使う記号を追加する
+		static void AddBasic();
+
+		/// @brief 保存した文字の一覧を読み込んで追加する
+		/// @param path ファイルのパス
+		/// @return 読み込めたら `true`
+		static bool Load(FilePathView path = DefaultPath);
+
+		/// @brief 文字列に含まれる文字を追加する まだグリフを作っていないものは、次の `Prewarm()` で作る
+		/// @param text 文字列
+		static void Add(StringView text);
+
+		/// @brief まだグリフを作っていない文字のグリフを、予算の時間だけ作る @n
+		/// 読み込み画面などで毎フレーム呼び出す
+		/// @param budget このフレームで使ってよい時間
+		/// @return まだグリフを作っていない文字の数
+		/// @remarks グリフはテクスチャに書き込むので、メインスレッドから呼び出す
+		static size_t Prewarm(const Duration &budget);
+
+		/// @brief まだグリフを作っていない文字の数を取得する
+		/// @return 文字の数
+		static size_t Remaining() noexcept;
+
+		/// @brief 新しい文字が追加されていれば、文字の一覧を保存する
+		/// @param path ファイルのパス
+		/// @return 保存できたか、保存する必要がなければ `true`
+		static bool Save(FilePathView path = DefaultPath);
+	};
+}
@@ -0,0 +1,22 @@
+﻿# pragma once
+
+namespace UFOCat::Util
+{
+	/// @brief バイト列のハッシュ値を計算する (FNV-1a 64bit) @n
+	/// キャッシュの照合やキーに使うためのもので、暗号用途には使わない
+	/// @param data 元データ
+	/// @param size バイト数
+	/// @return ハッシュ値
+	inline uint64 Fnv1a(const void *data, size_t size) noexcept
+	{
+		uint64 hash = 0xcbf29ce484222325;
+
+		for (const Byte *p = static_cast<const Byte *>(data), *end = p + size; p != end; ++p)
+		{
+			hash ^= static_cast<uint8>(*p);
+			hash *= 0x100000001b3;
+		}
+
+		return hash;
+	}
+}
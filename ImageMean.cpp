@@ -0,0 +1,80 @@
+﻿# include "ImageMean.hpp"
+
+# if defined(_M_X64) || defined(__SSE2__)
+#	define UFOCAT_USE_SSE2 1
+#	include <emmintrin.h>
+# else
+#	define UFOCAT_USE_SSE2 0
+# endif
+
+namespace UFOCat::Util
+{
+	ColorF MeanColor(const Image &image)
+	{
+		const size_t count = image.num_pixels();
+
+		if (count == 0)
+		{
+			return ColorF{ 0.0 };
+		}
+
+		const Color *pixels = image.data();
+
+		// 各チャンネルの和
+		uint64 sumR = 0;
+		uint64 sumG = 0;
+		uint64 sumB = 0;
+
+		size_t i = 0;
+
+# if UFOCAT_USE_SSE2
+		{
+			// Color は R, G, B, A の順に 1 バイトずつ並んでいるので、
+			// 16 バイト（4 ピクセル）ずつ読み込み、チャンネルごとに他のバイトを 0 にしてから
+			// _mm_sad_epu8 で 0 との差の絶対値の和（= そのまま和）を 8 バイトごとに 64bit で取る
+			const __m128i maskR = _mm_set1_epi32(0x000000FF);
+			const __m128i maskG = _mm_set1_epi32(0x0000FF00);
+			const __m128i maskB = _mm_set1_epi32(0x00FF0000);
+			const __m128i zero = _mm_setzero_si128();
+
+			__m128i accR = _mm_setzero_si128();
+			__m128i accG = _mm_setzero_si128();
+			__m128i accB = _mm_setzero_si128();
+
+			for (; (i + 4) <= count; i += 4)
+			{
+				const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pixels + i));
+
+				accR = _mm_add_epi64(accR, _mm_sad_epu8(_mm_and_si128(v, maskR), zero));
+				accG = _mm_add_epi64(accG, _mm_sad_epu8(_mm_and_si128(v, maskG), zero));
+				accB = _mm_add_epi64(accB, _mm_sad_epu8(_mm_and_si128(v, maskB), zero));
+			}
+
+			// 上位と下位の 64bit を足す
+			const auto horizontalSum = [](const __m128i &acc)
+			{
+				alignas(16) uint64 lanes[2];
+				_mm_store_si128(reinterpret_cast<__m128i *>(lanes), acc);
+				return lanes[0] + lanes[1];
+			};
+
+			sumR = horizontalSum(accR);
+			sumG = horizontalSum(accG);
+			sumB = horizontalSum(accB);
+		}
+# endif
+
+		// 残り（SSE2 が使えなければ全部）は 1 ピクセルずつ足す
+		for (; i < count; ++i)
+		{
+			sumR += pixels[i].r;
+			sumG += pixels[i].g;
+			sumB += pixels[i].b;
+		}
+
+		// 和をピクセル数で割って平均化し、さらに 255 で割って 0 ~ 1 に正規化
+		const double scale = 1.0 / (255.0 * count);
+
+		return ColorF{ sumR * scale, sumG * scale, sumB * scale };
+	}
+}
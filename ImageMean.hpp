@@ -0,0 +1,11 @@
+﻿# pragma once
+
+namespace UFOCat::Util
+{
+	/// @brief 画像の全ピクセルの RGB の平均値を求める @n
+	/// SSE2 が使える環境では 4 ピクセルずつまとめて足し合わせる
+	/// @param image 画像
+	/// @return 平均の色（アルファ値は 1） 空の画像なら黒
+	/// @note 和は 64bit で持つので、大きな画像でも桁あふれしない
+	ColorF MeanColor(const Image &image);
+}
@@ -0,0 +1,133 @@
+﻿# include "InputQueue.hpp"
+
+# if SIV3D_PLATFORM(WINDOWS)
+#	include <Siv3D/Windows/Windows.hpp>
+#	include <timeapi.h>
+#	pragma comment(lib, "winmm")
+# endif
+
+namespace UFOCat::Util
+{
+	InputQueue::InputQueue()
+		: m_prevFrameTime{ Time::GetMicrosec() }
+		, m_frameTime{ m_prevFrameTime }
+	{
+# if SIV3D_PLATFORM(WINDOWS)
+		// スリープの精度を 1ms にしておかないと、ポーリング間隔がフレーム間隔と変わらなくなる
+		::timeBeginPeriod(1);
+
+		m_isRunning = true;
+		m_thread = std::thread{ [this]() { m_poll(); } };
+# endif
+	}
+
+	InputQueue::~InputQueue()
+	{
+		if (m_thread.joinable())
+		{
+			m_isRunning = false;
+			m_thread.join();
+
+# if SIV3D_PLATFORM(WINDOWS)
+			::timeEndPeriod(1);
+# endif
+		}
+	}
+
+	void InputQueue::m_poll()
+	{
+# if SIV3D_PLATFORM(WINDOWS)
+		bool wasPressed = false;
+
+		while (m_isRunning)
+		{
+			// 左右ボタンを入れ替える設定になっていると、物理的な左ボタンは VK_RBUTTON で取れる
+			const int button = ::GetSystemMetrics(SM_SWAPBUTTON) ? VK_RBUTTON : VK_LBUTTON;
+			const bool isPressed = (::GetAsyncKeyState(button) & 0x8000) != 0;
+
+			// 押された瞬間だけ時刻を記録する
+			if (isPressed and (not wasPressed))
+			{
+				const uint64 now = Time::GetMicrosec();
+				std::lock_guard lock{ m_mutex };
+				m_pending << now;
+			}
+
+			wasPressed = isPressed;
+			std::this_thread::sleep_for(m_PollingInterval);
+		}
+# endif
+	}
+
+	void InputQueue::update()
+	{
+		m_prevFrameTime = m_frameTime;
+		m_frameTime = Time::GetMicrosec();
+
+		// 前のフレームで反応を出したクリックは、このフレームの System::Update() で画面に出ている
+		if (m_feedbackPending)
+		{
+			const uint64 latency = m_frameTime - *m_feedbackPending;
+			m_latency.last = latency;
+			m_latency.max = Max(m_latency.max, latency);
+			m_latency.sum += latency;
+			++m_latency.count;
+			m_feedbackPending.reset();
+
+# if _DEBUG
+			Logger << U"[InputQueue] click-to-feedback: {:.2f}ms (avg {:.2f}ms, max {:.2f}ms)"_fmt(latency / 1000.0, averageLatencyMs(), maxLatencyMs());
+# endif
+		}
+
+		Array<uint64> pending;
+		{
+			std::lock_guard lock{ m_mutex };
+			pending.swap(m_pending);
+		}
+
+		m_leftDown.reset();
+
+		// ウィンドウ外のクリックなども拾っているので、Siv3D 側でもクリックとして扱われたフレームだけ採用する
+		if (not MouseL.down())
+		{
+			return;
+		}
+
+		// 前のフレームからの間に記録された押下のうち、最初のものをこのクリックとみなす
+		// ポーリングが取りこぼした場合（とても短いクリックなど）は、フレームの時刻で代用する
+		const uint64 time = pending.isEmpty()
+			? m_frameTime
+			: Clamp(*std::min_element(pending.begin(), pending.end()), m_prevFrameTime, m_frameTime);
+
+		const double progress = (m_frameTime > m_prevFrameTime)
+			? static_cast<double>(time - m_prevFrameTime) / (m_frameTime - m_prevFrameTime)
+			: 1.0;
+
+		m_leftDown = Click{ time, Cursor::PreviousPosF().lerp(Cursor::PosF(), progress), progress };
+	}
+
+	const Optional<InputQueue::Click> &InputQueue::leftDown() const noexcept
+	{
+		return m_leftDown;
+	}
+
+	Duration InputQueue::Elapsed(const Click &click)
+	{
+		return Duration{ (Time::GetMicrosec() - click.time) / 1'000'000.0 };
+	}
+
+	void InputQueue::markFeedback(const Click &click)
+	{
+		m_feedbackPending = click.time;
+	}
+
+	double InputQueue::averageLatencyMs() const noexcept
+	{
+		return (m_latency.count == 0) ? 0.0 : (m_latency.sum / 1000.0 / m_latency.count);
+	}
+
+	double InputQueue::maxLatencyMs() const noexcept
+	{
+		return m_latency.max / 1000.0;
+	}
+}
@@ -0,0 +1,110 @@
+﻿# pragma once
+
+namespace UFOCat::Util
+{
+	/// @brief マウスの左ボタンが押された瞬間を、フレームの間隔より細かい時刻で記録する入力キュー @n
+	/// Siv3D の `MouseL.down()` はフレームごとにしか分からないので、別スレッドでボタンの状態をポーリングして
+	/// 押された時刻を記録し、そのフレームで `MouseL.down()` が `true` になったときだけその時刻を採用する
+	/// @note Windows 以外の環境では、フレームの時刻をそのままクリック時刻として扱う
+	class InputQueue
+	{
+	public:
+		/// @brief 1回のクリックの情報
+		struct Click
+		{
+			/// @brief クリックされた時刻 [us] (`Time::GetMicrosec()` 基準)
+			uint64 time = 0;
+
+			/// @brief クリック時刻でのカーソルのシーン座標（前のフレームと今のフレームのカーソル位置から補間したもの）
+			Vec2 position{ 0, 0 };
+
+			/// @brief 前のフレームから今のフレームまでの間のどの時点でクリックされたか (0.0 ~ 1.0)
+			/// @note 1.0 で今のフレームの時刻と同じ
+			double progress = 1.0;
+		};
+
+	private:
+		/// @brief ボタンの状態をポーリングする間隔
+		constexpr static std::chrono::microseconds m_PollingInterval{ 1000 };
+
+		/// @brief ポーリング用のスレッド
+		std::thread m_thread;
+
+		/// @brief ポーリングを続けるかどうか
+		std::atomic<bool> m_isRunning = false;
+
+		/// @brief `m_pending` を守るミューテックス
+		std::mutex m_mutex;
+
+		/// @brief ポーリングスレッドが記録した、まだフレームに割り振られていない押下時刻 [us]
+		Array<uint64> m_pending;
+
+		/// @brief 前のフレームの `update()` 時刻 [us]
+		uint64 m_prevFrameTime = 0;
+
+		/// @brief 今のフレームの `update()` 時刻 [us]
+		uint64 m_frameTime = 0;
+
+		/// @brief 今のフレームで確定した左クリック
+		Optional<Click> m_leftDown;
+
+		/// @brief フィードバックを出したクリックの時刻 次の `update()` で遅延を計測する
+		Optional<uint64> m_feedbackPending;
+
+		/// @brief クリックしてから反応が画面に出るまでにかかった時間の記録
+		struct
+		{
+			/// @brief 計測回数
+			size_t count = 0;
+
+			/// @brief 直近の遅延 [us]
+			uint64 last = 0;
+
+			/// @brief 最大の遅延 [us]
+			uint64 max = 0;
+
+			/// @brief 遅延の合計 [us]
+			uint64 sum = 0;
+		} m_latency;
+
+		/// @brief ポーリングスレッドの本体
+		void m_poll();
+
+	public:
+		/// @brief ポーリングスレッドを開始する
+		InputQueue();
+
+		InputQueue(const InputQueue &) = delete;
+
+		InputQueue &operator=(const InputQueue &) = delete;
+
+		/// @brief ポーリングスレッドを止める
+		~InputQueue();
+
+		/// @brief フレームの時刻を進め、このフレームの左クリックを確定させる @n
+		/// `System::Update()` の直後、シーンの更新より前に毎フレーム 1度 呼び出す
+		void update();
+
+		/// @brief このフレームで左ボタンが押されていれば、そのクリックの情報を取得する
+		/// @return クリックの情報 押されていなければ `none`
+		const Optional<Click> &leftDown() const noexcept;
+
+		/// @brief クリックされてから今までの経過時間を取得する
+		/// @param click クリックの情報
+		/// @return 経過時間
+		static Duration Elapsed(const Click &click);
+
+		/// @brief クリックに対する反応（効果音や画面の切り替え）を出したことを知らせる @n
+		/// 次のフレームの `update()` で、そのフレームが表示されるまでの遅延を計測する
+		/// @param click 反応したクリック
+		void markFeedback(const Click &click);
+
+		/// @brief クリックしてから反応が画面に出るまでの平均の遅延を取得する
+		/// @return 平均の遅延 [ms] まだ計測していなければ 0
+		double averageLatencyMs() const noexcept;
+
+		/// @brief クリックしてから反応が画面に出るまでの最大の遅延を取得する
+		/// @return 最大の遅延 [ms]
+		double maxLatencyMs() const noexcept;
+	};
+}
@@ -12,26 +12,33 @@ namespace UFOCat
 		return getData().scores.back().scores;
 	}
 
-	void Level::m_setTargetSpawnTime(size_t level)
+	void Level::m_spawn(const LevelPlan::Spawn &spawn)
 	{
-		// 定式の詳細は仕様書参照
-		const double&& term1 = m_currentLevel().timeLimit.count() / Random(2, 4);
-		const double&& term2 = level * (m_currentLevel().breedData.total() * m_currentLevel().intervalData.period.count()) / (m_currentLevel().actionDataList.size() * m_currentLevel().breedData.similar);
-
-		// 一度、ターゲットスポーン時間を設定
-		m_targetAppearTime = Duration{ Min((term1 + term2), 0.75 * m_currentLevel().timeLimit.count()) };
-	}
-
-	bool Level::m_hasAppearedTarget() const
-	{
-		if (not getData().spawns.isEmpty())
+		const bool isTarget = (spawn.selection == LevelPlan::TargetSelection);
+		const auto &cat = isTarget ? m_target : m_selections[spawn.selection];
+
+		auto &&object = std::make_unique<CatObject>
+		(
+			CatObject{ getData().catTextures.get(cat->textureId) }
+				.setRecolor(getData().catTextures.getRecolor(*cat))
+				.setHitMask(getData().hitMasks[cat->index])
+				.setAction(m_currentLevel().actionDataList[spawn.action])
+		);
+
+		// アクションも速度も計画で決めてあるので、ここでは抽選しない
+		// アクション中の動きは、レベルの乱数から決めたシード値で猫ごとに決める
+		object->velocity = spawn.velocity;
+		object->setSeed(m_rng());
+
+		if (isTarget)
 		{
-			// ターゲットは 0番目 に入れるよう保証しているので、0番目が nullptr でなければ出現済み
-			return getData().spawns[0] != nullptr;
+			// ターゲットは 0 番目を上書きする
+			object->setCatData(*cat);
+			getData().spawns[0] = std::move(object);
 		}
 		else
 		{
-			return false;
+			getData().spawns << std::move(object);
 		}
 	}
 
@@ -41,28 +48,67 @@ namespace UFOCat
 		return (getData().levelIndex + 1) < getData().levels.size();
 	}
 
+	Optional<size_t> Level::m_findTopmostCat(const Util::InputQueue::Click &click, bool *const isCorrect)
+	{
+		// 後ろのほうが手前に描画されているので、後ろから順に当たり判定を調べる
+		// 判定はクリックがあったフレームに 1度 だけなので、空間インデックスを作るよりこのほうが速い
+		Optional<size_t> found;
+		bool isCorrectCandidate = false;
+
+		for (size_t i = getData().spawns.size(); i-- > 0;)
+		{
+			const auto &cat = getData().spawns[i];
+
+			// 見えていない猫はクリックされても捕まえられない
+			// 外接矩形に入っていなければ、ピクセル単位の判定はしない
+			if (cat and cat->isVisible()
+				and cat->getBoundingRect(click.progress).intersects(click.position)
+				and cat->checkCatchable(click.position, *m_target, &isCorrectCandidate, click.progress))
+			{
+				found = i;
+				break;
+			}
+		}
+
+		if (found)
+		{
+			*isCorrect = isCorrectCandidate;
+		}
+
+		return found;
+	}
+
 	Level::Level(const InitData& init)
 		: IScene{ init }
 	{
 		// GUI初期化 と テクスチャ取得
 		{
-			m_gui.timer = Texture{ U"texture/timer.png", TextureDesc::Mipped };
+			m_gui.timer = getData().assets.loadTexture(U"texture/timer.png", TextureDesc::Mipped);
 			m_gui.dialog.setContents
 			(
 				GUI::TextBox{ FontAsset(Util::FontFamily::YuseiMagic)(U"本当に戻りますか？\nここまでのデータは失われます"), 20, Util::Palette::Brown }.setPositionAt({ 135, 40 })
 			).setSize({ 350, 200 });
-			m_bg = getData().backgrounds.choice();
+
+			// ボタンの見た目はここで一度だけ決めておき、更新処理では位置と有効状態だけを変える
+			m_gui.toNextLevel.set(32, U"次のレベルへ");
+			m_gui.toResult.set(32, U"結果 / タイトルへ");
+			m_bg = getData().backgrounds.choice().loaded(getData().assets);
 		}
 
+		// 次の Result シーンで使う効果音を読み込んでおく
+		getData().soundEffects.preload({ Util::AudioSource::SE::CountUpScore, Util::AudioSource::SE::FinishScore });
+
+		// レベルデータのホットリロードは、このレベルが終わるまで待ってもらう
+		getData().isPlayingLevel = true;
+
 		// 前回レベルでスポーンした猫を吹っ飛ばし、unique_ptr も解放する
 		getData().spawns.release();
 
 		// 0 番目に空のポインタを入れて置き、
 		// ターゲットをスポーンさせるときはここを上書きする形にする
 		// こうすることで、0 番目が nullptr かどうかでターゲットの出現判定ができるようになるうえに、
-		// `catchable()` で判定をする際に、ターゲットを最も初めにチェックするので、
-		// 当たり判定を優遇することができる（ミスタップを起こしにくい）
-		// しかも一番初めに描画されるので、ターゲットが他の猫に隠れて見えづらいパターンが発生することもあり、難易度がちょっと上がる
+		// 一番初めに描画されるので、ターゲットが他の猫に隠れて見えづらいパターンが発生することもあり、難易度がちょっと上がる
+		// （クリック判定は見た目どおり手前の猫が優先されるので、隠れている間は捕まえられない）
 		getData().spawns << nullptr;
 
 		// 前回レベルで選んだ猫を吹っ飛ばし、shared_ptr も解放する
@@ -72,112 +118,55 @@ namespace UFOCat
 		m_score.level = getData().levelIndex + 1;
 
 		// 前回シーンで決めたターゲットを取得
-		m_target = getData().cats[getData().targetId];
-
-		// レベルデータのうち、登場する猫の数に関するデータを取得する
-		const auto& similarCount = m_currentLevel().breedData.similar;
-		const auto& otherCount = m_currentLevel().breedData.other;
-
-		// それぞれ、似ている猫とそうじゃない猫を絞り込む用の配列を用意する
-		Array<const CatData*> similars;
-		Array<const CatData*> others;
+		m_target = getData().cats[getData().targetIndex];
 
-		// 全種類の猫の中から、ターゲットと似ている猫とそうでない猫を振り分ける
-		for (const auto& cat : getData().cats)
+		// Wanted シーンで立てた計画を使う
+		// （レベルデータの差し替えなどで計画がなければ、ここで立てる）
+		if (not (getData().levelPlan and getData().levelPlan->isFor(getData().levelIndex, getData().targetIndex)))
 		{
-			// それと、ターゲットと同じのを参照しないように保障する
-			if (m_currentLevel().similarity == cat->getSameDataCount(*m_target)
-				and *cat != *m_target)
-			{
-				similars << cat.get();
-			}
-			// 類似条件を下回るのを「その他」としてカウント
-			else if (m_currentLevel().similarity > cat->getSameDataCount(*m_target))
-			{
-				others << cat.get();
-			}
-		}
-
-		// 宇宙船演算子が使いたかっただけ！！！
-		// 上で絞り込んだ結果、similars の数が既定 (similarCount) より多すぎるか、少なすぎる場合に調整する
-		// まずは多すぎる場合
-		if (auto comp = similars.size() <=> similarCount;
-			comp > 0)
-		{
-			// 多すぎる場合はランダムに頭数を削る
-			similars.shuffle().resize(similarCount);
-		}
-		// 少なすぎる場合
-		else if (comp < 0)
-		{
-			// 条件を緩和して絞り込んだ猫を入れる配列
-			Array<const CatData*> looses;
-
-			// 類似度を1つ下げて絞り込んだものを looses に入れる
-			for (const auto& cat : others)
-			{
-				if ((m_currentLevel().similarity - 1) == cat->getSameDataCount(*m_target)
-					and *cat != *m_target)
-				{
-					looses << cat;
-				}
-			}
-
-			// 足りなかった分を looses か others から補う
-			while (similars.size() < similarCount)
-			{
-				if (not looses.isEmpty())
-				{
-					similars << looses.shuffle().choice();
-				}
-				else
-				{
-					// others から補うことになった場合は補ったやつを元のリストから消す
-					// others はもともと多く絞り込まれるはずなので、枯渇することはない
-					const auto& instead = others.shuffle().choice();
-					similars << instead;
-					others.remove(instead);
-				}
-			}
-
+			getData().levelPlan = LevelPlan::Create(m_currentLevel(), getData().levelIndex, getData().similarities, getData().targetIndex, Scene::Size(), GetDefaultRNG());
 		}
 
-		// others は既定の数から溢れている可能性が高いので、ランダムに削る
-		if (others.size() > otherCount)
-		{
-			others.shuffle().resize(otherCount);
-		}
-		// 既定の数に達しない場合は、それでもよしとする
-		// 無理にほかの種類も含めようとすると、難易度が上がりすぎる可能性がある？
+		const auto &plan = *getData().levelPlan;
 
-		// 結局、似てるのと他のでどの猫を使うのかまとめておく
-		Array<size_t> ids = similars.map([](const auto &s) { return s->id; }).append(others.map([](const auto &o) { return o->id; } ));
+		// レベル中の乱数は計画のシード値から始めるので、同じ計画なら同じように猫が出てくる
+		m_rng.seed(plan.seed);
 
 		// 重複無しがいいので set を利用
-		m_selectionsId = HashSet<size_t>{ ids.begin(), ids.end() };
+		m_selectionIndices = HashSet<size_t>{ plan.selectionIndices.begin(), plan.selectionIndices.end() };
 
-		
-		for (auto &&id : m_selectionsId)
+		for (auto &&index : plan.selectionIndices)
 		{
-			// 必要なテクスチャアセットの非同期ロードを始める
-			TextureAsset::LoadAsync(Cat(id));
-
 			// 猫データも共有しておく
-			m_selections << getData().cats[id];
+			m_selections << getData().cats[index];
+
+			// テクスチャは Wanted シーンの間に読み込み済みのはずだが、計画を立て直した場合はここで読み込みを始める
+			// レベルの間はずっとスポーンさせるので、解放されないように使用中にしておく
+			getData().catTextures.prefetch(m_selections.back()->textureId);
+			getData().catTextures.pin(m_selections.back()->textureId);
 		}
-		// ロードの間も以下を続行
 
-		// レベル中に行うアクションリストの中から、それぞれの発生確率だけを抜き取ったリストで確率分布をつくる
-		m_actionProbabilities = DiscreteDistribution{ m_currentLevel().actionDataList.map([](const LevelData::ActionData& data) { return data.probability; }) };
+		getData().catTextures.prefetch(m_target->textureId);
+		getData().catTextures.pin(m_target->textureId);
+
+		m_spawnTimeline = plan.spawns;
+		m_nextSpawnIndex = 0;
+
+		// スポーンした猫はレベルが終わるまで消えないので、計画から分かる最大数だけ最初に確保しておく
+		getData().spawns.reserve(plan.peakSpawnCount);
 
-		// 現在のレベルに合わせてターゲットの出現時刻を設定
-		m_setTargetSpawnTime(getData().levelIndex + 1);
+		// 現在のレベルに合わせて計画で決めた、ターゲットの出現時刻を設定
+		// ただし、この時刻はあくまでスポーンのタイミングで使われるだけで、その時点ですぐにターゲットが視認できるとは限らない -> `m_targetFirstVisible`
+		m_targetAppearTime = plan.targetAppearTime;
 
-		AudioAsset(getData().bgmName).stop();
+		getData().audio.stop(getData().bgmName);
 
-		// BGM 抽選
+		// BGM 抽選 猫の動きには関係ないので、レベルの乱数ではなくスレッドの乱数を使う
 		getData().bgmName = Array{ Util::AudioSource::BGM::Level01, Util::AudioSource::BGM::Level02 }.choice();
 
+		// カウントダウンの間にストリーミングの準備を済ませておき、再生を始めるときに引っかからないようにする
+		getData().audio.prebuffer(getData().bgmName);
+
 		// 3、2、1、GO! のカウントダウンを入れるための待機時間をセット
 		// シーンのフェードインアウト時間を考慮して少し長め = 4s に取る
 		getData().timer.pause();
@@ -199,11 +188,11 @@ namespace UFOCat
 					if (not getData().timer.reachedZero())
 					{
 						// 使用する猫のアセットが全てロードされていれば
-						if (std::all_of(m_selectionsId.begin(), m_selectionsId.end(), [](const size_t id)
+						if (m_selections.all([this](const auto &selection)
 							{
-								return TextureAsset::IsReady(Cat(id));
+								return getData().catTextures.isReady(selection->textureId);
 							})
-							and TextureAsset::IsReady(Cat(m_target->id)))
+							and getData().catTextures.isReady(m_target->textureId))
 						{
 							// カウントダウンはじめ
 							getData().timer.start();
@@ -229,12 +218,12 @@ namespace UFOCat
 						{
 							// カウントダウンの音
 							// ここでは 3 回なる
-							AudioAsset(Util::AudioSource::SE::CountDown).playOneShot();
+							getData().audio.playOneShot(Util::AudioSource::SE::CountDown);
 						}
 						else
 						{
 							// スタートの音（ぴーっ）
-							AudioAsset(Util::AudioSource::SE::StartLevel).playOneShot();
+							getData().audio.playOneShot(Util::AudioSource::SE::StartLevel);
 						}
 					}
 					m_prevTimerRemaining = getData().timer.s();
@@ -245,36 +234,13 @@ namespace UFOCat
 			case Level::State::Playing:
 			{
 				// ## スポーン処理
-				m_watch.setInterval([this]()
-					{
-						// ターゲットの出現時刻を超えていて、ターゲットがまだ出現していなかったら
-						if (getData().timer.remaining() <= m_targetAppearTime and (not m_hasAppearedTarget()))
-						{
-							// ターゲットを湧かせる
-							getData().spawns[0] = std::make_unique<CatObject>(CatObject{ TextureAsset(Cat(m_target->id)) }.setCatData(*m_target));
+				// 計画で決めておいたスポーンのうち、時刻が来たものを出す
+				m_watch.forward();
 
-							// ターゲットにも同様にアクションと速度の設定を行う
-							getData().spawns[0]->setAction(DiscreteSample(m_currentLevel().actionDataList, m_actionProbabilities)).setRandomVelocity(getData().levelIndex + 1);
-						}
-						else
-						{
-							// ターゲット以外の猫をランダムに指定個選んで（コピーして）追加
-							for (uint32 i = 0; i < m_currentLevel().intervalData.count; i++)
-							{
-								// 1個適当に選ぶ
-								const auto &selection = m_selections.choice();
-
-								// アクションを抽選してセットし、現在のレベルに合わせて速度もランダムに決める
-								// そしてスポーンリストに追加
-								getData().spawns << std::make_unique<CatObject>
-													(
-														CatObject{ TextureAsset(Cat(selection->id)) }
-															.setAction(DiscreteSample(m_currentLevel().actionDataList, m_actionProbabilities))
-															.setRandomVelocity(getData().levelIndex + 1)
-													);
-							}
-						}
-					}, m_currentLevel().intervalData.period);
+				while ((m_nextSpawnIndex < m_spawnTimeline.size()) and (m_spawnTimeline[m_nextSpawnIndex].time <= m_watch.now()))
+				{
+					m_spawn(m_spawnTimeline[m_nextSpawnIndex++]);
+				}
 
 				// ## 制限時間内と時間超過後での処理
 				
@@ -287,66 +253,84 @@ namespace UFOCat
 					}
 					// これ以下はタイマー残り時間が 30s 以下であることを保証する
 
-					AudioAsset(getData().bgmName).play();
+					getData().audio.play(getData().bgmName);
 
-					// ターゲットから順に捜査する
+					// 全ての猫を動かす（当たり判定の位置もここで更新される）
 					for (const auto& cat : getData().spawns)
 					{
-						if (not cat)
+						if (cat)
 						{
-							continue;
+							cat->act();
+
+							// 画面に出てきた猫は鳴く 実際に鳴らすのはカーソルに近いものからボイスの数まで
+							// 鳴き声の抽選はプレイによって回数が変わるので、レベルの乱数（スポーンのシード値）からは取らない
+							if (cat->hasJustAppeared())
+							{
+								getData().catVoices.request(RandomBool(0.5) ? Util::AudioSource::SE::Cat01 : Util::AudioSource::SE::Cat02, cat->getBoundingRect().center(), Cursor::PosF());
+							}
 						}
+					}
+
+					// クリックがあったフレームだけ、クリックされた時点で一番手前にいた猫を探す
+					// 猫をタッチしたら、その正誤を代入
+					const auto &click = getData().input.leftDown();
+
+					if (const auto caught = click ? m_findTopmostCat(*click, &m_score.isCorrect) : none)
+					{
+						// 捕まえた猫を記録
+						m_caught = &getData().spawns[*caught];
 
-						// 猫をタッチしたら、その正誤を代入
-						if (cat->act().checkCatchable(*m_target, &m_score.isCorrect))
+						// 違う猫を捕まえたら、その猫が怒る ほかの鳴き声よりも優先して鳴らす
+						if (not m_score.isCorrect)
 						{
-							// 捕まえた猫を記録
-							m_caught = &cat;
+							getData().catVoices.request(Util::AudioSource::SE::CatAngry, (*m_caught)->getBoundingRect().center(), click->position, 10.0);
+						}
 
-							// ターゲットとの正誤にかかわらず、触ったことにはしておく
-							m_score.isCaught = true;
+						// ターゲットとの正誤にかかわらず、触ったことにはしておく
+						m_score.isCaught = true;
 
-							// 反応時間を記録
-							m_score.response = (m_targetAppearTime - getData().timer.remaining()).count();
+						// 反応時間を記録
+						// フレームを待っていた分は含めないように、クリックされた時点での残り時間で計算する
+						m_score.response = (m_targetAppearTime - (getData().timer.remaining() + Util::InputQueue::Elapsed(*click))).count();
 
-							// 連続正解数を記録
+						// 連続正解数を記録
 
-							// 仮変数
-							uint32 temp_consecutive = 0;
+						// 仮変数
+						uint32 temp_consecutive = 0;
 
-							for (size_t i = 0; i < m_currentScoreDatas().size() - 1; i++)
+						for (size_t i = 0; i < m_currentScoreDatas().size() - 1; i++)
+						{
+							// 次のスコアデータが存在しない場合は終了
+							if (m_currentScoreDatas()[i + 1].level == InvalidIndex)
 							{
-								// 次のスコアデータが存在しない場合は終了
-								if (m_currentScoreDatas()[i + 1].level == InvalidIndex)
-								{
-									break;
-								}
-
-								// 今のレベルと次のレベルの両方で正解していたら増やす
-								if (m_currentScoreDatas()[i].isCorrect and m_currentScoreDatas()[i + 1].isCorrect)
-								{
-									++temp_consecutive;
-								}
-								else
-								{
-									temp_consecutive = 0;
-								}
+								break;
 							}
 
-							// 記録
-							m_score.consecutiveCorrect = temp_consecutive;
+							// 今のレベルと次のレベルの両方で正解していたら増やす
+							if (m_currentScoreDatas()[i].isCorrect and m_currentScoreDatas()[i + 1].isCorrect)
+							{
+								++temp_consecutive;
+							}
+							else
+							{
+								temp_consecutive = 0;
+							}
+						}
 
-							// プレイ終了へ
-							m_state = Level::State::Finish;
+						// 記録
+						m_score.consecutiveCorrect = temp_consecutive;
 
-							// 明示的にストップウォッチリセット（でないと積算時間が持ち越される）
-							m_watch.reset();
+						// プレイ終了へ
+						m_state = Level::State::Finish;
 
-							AudioAsset(Util::AudioSource::SE::FinishLevel).playOneShot();
-							AudioAsset(getData().bgmName).fadeVolume(0.0, 1s);
+						// 明示的にストップウォッチリセット（でないと積算時間が持ち越される）
+						m_watch.reset();
 
-							break;
-						}
+						getData().audio.playOneShot(Util::AudioSource::SE::FinishLevel);
+						getData().audio.fadeVolume(getData().bgmName, 0.0, 1s);
+
+						// 反応が画面に出るまでの遅延を計測
+						getData().input.markFeedback(*click);
 					}
 
 					// ターゲットが初めて画面上に見えたかどうかを記録する
@@ -374,8 +358,8 @@ namespace UFOCat
 						// 明示的にストップウォッチリセット（でないと積算時間が持ち越される）
 						m_watch.reset();
 
-						AudioAsset(Util::AudioSource::SE::FinishLevel).playOneShot();
-						AudioAsset(getData().bgmName).fadeVolume(0.0, 1s);
+						getData().audio.playOneShot(Util::AudioSource::SE::FinishLevel);
+						getData().audio.fadeVolume(getData().bgmName, 0.0, 1s);
 					}
 				}
 
@@ -393,7 +377,7 @@ namespace UFOCat
 						// 明示的にストップウォッチリセット（でないと積算時間が持ち越される）
 						m_watch.reset();
 
-						AudioAsset(getData().bgmName).stop();
+						getData().audio.stop(getData().bgmName);
 					}, 3s);
 			}
 			break;
@@ -402,7 +386,7 @@ namespace UFOCat
 			{
 				m_watch.setTimeout([this]()
 				{
-					AudioAsset(m_score.isCaught ? (m_score.isCorrect ? Util::AudioSource::SE::Correct : Util::AudioSource::SE::Incorrect) : Util::AudioSource::SE::TimeUp).playOneShot();
+					getData().audio.playOneShot(m_score.isCaught ? (m_score.isCorrect ? Util::AudioSource::SE::Correct : Util::AudioSource::SE::Incorrect) : Util::AudioSource::SE::TimeUp);
 				}, 0.2s);
 
 				// # GUI 処理
@@ -411,7 +395,7 @@ namespace UFOCat
 					bool canContinue = (m_score.isCorrect and m_isAvailableNextLevel());
 
 					// 次のレベルへ進むボタン
-					if (m_gui.toNextLevel.set(32, U"次のレベルへ", GUI::PositionType::Absolute, canContinue)
+					if (m_gui.toNextLevel.setEnabled(canContinue)
 										 .setPosition(Arg::bottomRight = (Scene::Size() - Vec2{ 10.0, 10.0 })).isPressed())
 					{
 						// 次に進む場合は、レベルデータにもクリア情報を反映
@@ -426,8 +410,7 @@ namespace UFOCat
 					}
 
 					// タイトルへ戻るボタン
-					if (m_gui.toResult.set(32, U"結果 / タイトルへ")
-									  .setPosition(Arg::bottomLeft = Vec2{ 10.0, Scene::Height() - 10.0 })
+					if (m_gui.toResult.setPosition(Arg::bottomLeft = Vec2{ 10.0, Scene::Height() - 10.0 })
 									  .isPressed())
 					{
 						if (canContinue)
@@ -469,6 +452,9 @@ namespace UFOCat
 				break;
 		}
 
+		// このフレームに鳴いた猫のうち、優先度の高いものだけを鳴らす
+		getData().catVoices.update(Cursor::PosF());
+
 # if _DEBUG    // デバッグ機能：
 		if (KeyControl.pressed() and KeyShift.pressed())
 		{
@@ -660,8 +646,16 @@ namespace UFOCat
 				}
 				// 画面右側 ターゲットを表示
 				{
-					auto &&image = TextureAsset(Cat(m_target->id)).scaled(m_CatTextureScale);
-					image.drawAt(Scene::CenterF() + SizeF(image.size.x, 0));
+					auto &&image = getData().catTextures.get(m_target->textureId).scaled(m_CatTextureScale);
+
+					if (const auto recolor = getData().catTextures.getRecolor(*m_target))
+					{
+						recolor->drawAt(image, Scene::CenterF() + SizeF(image.size.x, 0));
+					}
+					else
+					{
+						image.drawAt(Scene::CenterF() + SizeF(image.size.x, 0));
+					}
 					FontAsset(Util::FontFamily::YuseiMagic)(U"ターゲット").drawAt(Scene::CenterF() + SizeF(image.size.x, -150));
 				}
 				// 画面中央下部 結果表示
@@ -702,7 +696,20 @@ namespace UFOCat
 
 	Level::~Level()
 	{
-		AudioAsset(getData().bgmName).stop();
-		TextureAsset::ReleaseAll();
+		getData().isPlayingLevel = false;
+		getData().audio.stop(getData().bgmName);
+		getData().catVoices.stopAll();
+
+		// このレベルで使った猫のテクスチャを使用中でなくし、
+		// 予算を超えている分だけ、しばらく使っていないものから解放する
+		// 次のレベルでも登場する猫やターゲットは、予算に余裕があれば読み込み直さずに済む
+		for (const auto &selection : m_selections)
+		{
+			getData().catTextures.unpin(selection->textureId);
+		}
+
+		getData().catTextures.unpin(m_target->textureId);
+		getData().catTextures.trim();
+		getData().soundEffects.trim();
 	}
 }
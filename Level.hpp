@@ -28,8 +28,8 @@ namespace UFOCat
 		/// @brief このレベルで出現させる猫を絞り込んだリスト
 		Array<std::shared_ptr<CatData>> m_selections;
 
-		/// @brief このレベルで出現させる猫のIDを重複を無視して絞り込んだリスト
-		HashSet<size_t> m_selectionsId;
+		/// @brief このレベルで出現させる猫の `GameData::cats` でのインデックスを重複を無視して絞り込んだリスト
+		HashSet<size_t> m_selectionIndices;
 
 		/// @brief フェーズ中にターゲットが出現する時刻 @n
 		/// 途中、初めてターゲットが視認できるようになったことを確認できた時点で、数値を入れ替える！！ @n
@@ -39,13 +39,21 @@ namespace UFOCat
 		/// @brief 初めてターゲットが画面上に見えた（見えるようになった）かどうか
 		bool m_targetFirstVisible = false;
 
-		/// @brief 現在のフェーズで起こせるアクションの確率分布
-		DiscreteDistribution m_actionProbabilities;
+		/// @brief レベル中の乱数生成器 計画のシード値で初期化するので、同じ計画なら同じように猫が出てくる
+		/// @note メインスレッドの乱数生成器を初期化し直すと、タイトルで決めるシード値などまで同じになってしまうので分けている @n
+		/// スポーンの順に決まる値（猫ごとのシード値）にだけ使い、鳴き声などプレイによって回数が変わる抽選には使わない
+		DefaultRNG m_rng;
+
+		/// @brief 計画で決めておいた、このレベルの全てのスポーン
+		Array<LevelPlan::Spawn> m_spawnTimeline;
+
+		/// @brief 次にスポーンさせる `m_spawnTimeline` のインデックス
+		size_t m_nextSpawnIndex = 0;
 
 		/// @brief シーン内ステート
 		Level::State m_state = Level::State::Before;
 
-		/// @brief スポーン間隔の計測やシーン内ステートの遷移などに使う内部ストップウォッチ
+		/// @brief スポーン時刻の計測やシーン内ステートの遷移などに使う内部ストップウォッチ
 		Util::Stopwatch m_watch;
 
 		/// @brief カウントダウンの時に使う、1フレーム前の timer.s() を保存しておく変数
@@ -90,19 +98,20 @@ namespace UFOCat
 		/// @return 
 		Array<Score::Generic::ByLevel> &m_currentScoreDatas() const;
 
-		/// @brief ターゲットが出現する時間を引数に応じてランダムに決め、`m_targetAppearTime` に設定する
-		/// @param level 整数値（1 ~ 10 の範囲で、特に現在のレベル値を入れることを想定）
-		/// @remarks ただし、この値はあくまでスポーンのタイミングで使われるだけで、その時点ですぐにターゲットが視認できるとは限らない -> `m_targetFirstVisible`
-		void m_setTargetSpawnTime(size_t level);
-
-		/// @brief ターゲットが出現したかどうか
-		/// @return 既に出現させていたら `true`
-		bool m_hasAppearedTarget() const;
+		/// @brief 計画で決めておいたスポーンの通りに、猫をスポーンさせる
+		/// @param spawn スポーン
+		void m_spawn(const LevelPlan::Spawn &spawn);
 
 		/// @brief 次のレベルに進めるかどうか
 		/// @return 進めるなら `true`
 		bool m_isAvailableNextLevel() const;
 
+		/// @brief クリックされた時点で、その座標に描画順で一番手前に見えている猫を探す
+		/// @param click クリックの情報 猫の位置はクリックされた時点のものに補間して判定する
+		/// @param isCorrect 見つかった猫がターゲットと同じかどうかを格納する出力先変数へのポインタ（見つかったときのみ書き換える）
+		/// @return 見つかった猫の `spawns` でのインデックス 見つからなければ `none`
+		Optional<size_t> m_findTopmostCat(const Util::InputQueue::Click &click, bool *const isCorrect);
+
 	public:
 		Level(const InitData &init);
 
@@ -1,35 +1,398 @@
 ﻿# include "LevelData.hpp"
-# include <regex>
+
+namespace
+{
+	using namespace UFOCat;
+	using namespace UFOCat::Core;
+
+	/// @brief イージング関数のポインタの型
+	using EasingPointer = double(*)(double);
+
+	/// @brief イージング関数の番号とポインタの対応表（インデックスが番号）
+	/// @note 並びを変えると、保存済みのキャッシュと互換性がなくなる
+	constexpr std::array<EasingPointer, 10> EasingTable =
+	{
+		Easing::Linear,
+		Easing::Sine,
+		Easing::Quad,
+		Easing::Cubic,
+		Easing::Quart,
+		Easing::Expo,
+		Easing::Circ,
+		Easing::Back,
+		Easing::Elastic,
+		Easing::Bounce
+	};
+
+	/// @brief `EasingTable` と同じ並びの、"e_" を除いた小文字のイージング関数名
+	constexpr std::array<StringView, EasingTable.size()> EasingNames =
+	{
+		U"linear",
+		U"sine",
+		U"quad",
+		U"cubic",
+		U"quart",
+		U"expo",
+		U"circ",
+		U"back",
+		U"elastic",
+		U"bounce"
+	};
+
+	/// @brief パラメータの文字列を1回なめて分類・変換した結果
+	struct ParamToken
+	{
+		enum class Kind
+		{
+			/// @brief "2.5s" の形
+			Duration,
+			/// @brief "(x, y, w, h)" の形
+			Rect,
+			/// @brief "e_xxx" の形
+			Easing
+		};
+
+		Kind kind;
+
+		/// @brief `Kind::Duration` のときの秒数
+		double seconds = 0.0;
+
+		/// @brief `Kind::Rect` のときの矩形
+		Rect rect{ 0, 0, 0, 0 };
+
+		/// @brief `Kind::Easing` のときの `EasingTable` の番号
+		uint8 easing = 0;
+	};
+
+	/// @brief 文字列を1文字ずつ先頭から読んでいくための簡単なスキャナ
+	class Scanner
+	{
+	private:
+		StringView m_str;
+
+		size_t m_pos = 0;
+
+	public:
+		explicit Scanner(StringView str)
+			: m_str{ str }
+		{}
+
+		bool isEnd() const noexcept
+		{
+			return m_pos >= m_str.size();
+		}
+
+		char32 peek() const noexcept
+		{
+			return isEnd() ? U'\0' : m_str[m_pos];
+		}
+
+		/// @brief 次の文字が指定した文字なら読み進める
+		bool consume(char32 c) noexcept
+		{
+			if (peek() == c)
+			{
+				++m_pos;
+				return true;
+			}
+			return false;
+		}
+
+		void skipSpaces() noexcept
+		{
+			while (IsSpace(peek()))
+			{
+				++m_pos;
+			}
+		}
+
+		/// @brief 0 以上の整数を読む
+		Optional<int32> integer() noexcept
+		{
+			if (not IsDigit(peek()))
+			{
+				return none;
+			}
+
+			int64 value = 0;
+
+			while (IsDigit(peek()) and value <= Largest<int32>)
+			{
+				value = value * 10 + (m_str[m_pos++] - U'0');
+			}
+
+			return (value <= Largest<int32>) ? Optional<int32>{ static_cast<int32>(value) } : none;
+		}
+
+		/// @brief 0 以上の小数 ("12", "2.5", ".5") を読む
+		/// @note 有効数字 15 桁までなら仮数と 10 の累乗がどちらも double で正確に表せるので、割り算 1 回で正しく丸められる
+		Optional<double> decimal() noexcept
+		{
+			constexpr std::array<double, 16> Pow10 = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15 };
+
+			uint64 mantissa = 0;
+			size_t digits = 0;
+			size_t fractionDigits = 0;
+			bool isFraction = false;
+
+			for (;; ++m_pos)
+			{
+				if (const char32 c = peek(); IsDigit(c))
+				{
+					if (++digits > 15)
+					{
+						return none;
+					}
+
+					mantissa = mantissa * 10 + (c - U'0');
+					fractionDigits += isFraction;
+				}
+				else if ((c == U'.') and (not isFraction))
+				{
+					isFraction = true;
+				}
+				else
+				{
+					break;
+				}
+			}
+
+			if (digits == 0)
+			{
+				return none;
+			}
+
+			return static_cast<double>(mantissa) / Pow10[fractionDigits];
+		}
+
+		/// @brief 残りの文字列を取得する
+		StringView rest() const noexcept
+		{
+			return m_str.substr(Min(m_pos, m_str.size()));
+		}
+	};
+
+	/// @brief パラメータの文字列を先頭から1回だけ読んで、Duration / Rect / イージング関数のいずれかに変換する
+	/// @param str 対象文字列
+	/// @return 変換結果 どの形式にも当てはまらなければ `none`
+	Optional<ParamToken> Tokenize(StringView str)
+	{
+		Scanner scanner{ str };
+
+		// 先頭の1文字でどの形式か決まる
+		switch (scanner.peek())
+		{
+			case U'(':
+			{
+				scanner.consume(U'(');
+
+				std::array<int32, 4> values{};
+
+				for (size_t i = 0; i < values.size(); ++i)
+				{
+					scanner.skipSpaces();
+
+					if (const auto value = scanner.integer())
+					{
+						values[i] = *value;
+					}
+					else
+					{
+						return none;
+					}
+
+					scanner.skipSpaces();
+
+					// 最後だけ閉じ括弧、それ以外はカンマで区切られている
+					if (not scanner.consume((i + 1 < values.size()) ? U',' : U')'))
+					{
+						return none;
+					}
+				}
+
+				if (not scanner.isEnd())
+				{
+					return none;
+				}
+
+				return ParamToken{ .kind = ParamToken::Kind::Rect, .rect = Rect{ values[0], values[1], values[2], values[3] } };
+			}
+
+			case U'e':
+			{
+				if (not (scanner.consume(U'e') and scanner.consume(U'_')))
+				{
+					return none;
+				}
+
+				// 大文字小文字は区別しない
+				const StringView name = scanner.rest();
+
+				for (size_t i = 0; i < EasingNames.size(); ++i)
+				{
+					if (name.size() == EasingNames[i].size()
+						and std::equal(name.begin(), name.end(), EasingNames[i].begin(), [](char32 a, char32 b) { return ToLower(a) == b; }))
+					{
+						return ParamToken{ .kind = ParamToken::Kind::Easing, .easing = static_cast<uint8>(i) };
+					}
+				}
+
+				return none;
+			}
+
+			default:
+			{
+				const auto seconds = scanner.decimal();
+
+				if (seconds and scanner.consume(U's') and scanner.isEnd())
+				{
+					return ParamToken{ .kind = ParamToken::Kind::Duration, .seconds = *seconds };
+				}
+
+				return none;
+			}
+		}
+	}
+
+	/// @brief JSON の値を1つ、タプル型から期待される型 T として読む
+	/// @tparam T `Action.hpp` のタプルの要素の型
+	/// @param value JSON の値
+	/// @param index 何番目の引数か（エラー表示用）
+	/// @return 変換した値 期待される形式でなければ例外を投げる
+	template <typename T>
+	T ParseValue(const JSON &value, size_t index)
+	{
+		if constexpr (std::same_as<T, uint32>)
+		{
+			if (value.isNumber())
+			{
+				return value.get<uint32>();
+			}
+		}
+		// `appearFromEdge` の `overflow` でしか配列を引数にとらない（`overflow` の仕様は `CatObject.hpp` を参照）
+		else if constexpr (std::same_as<T, std::array<double, 4>>)
+		{
+			if (value.isArray() and value.size() == 4)
+			{
+				return std::array<double, 4>{ value[0].get<double>(), value[1].get<double>(), value[2].get<double>(), value[3].get<double>() };
+			}
+		}
+		else
+		{
+			constexpr auto Expected = std::same_as<T, Duration> ? ParamToken::Kind::Duration
+									: std::same_as<T, Rect> ? ParamToken::Kind::Rect
+									: ParamToken::Kind::Easing;
+
+			if (const auto token = value.isString() ? Tokenize(value.getString()) : none;
+				token and token->kind == Expected)
+			{
+				if constexpr (std::same_as<T, Duration>)
+				{
+					return Duration{ token->seconds };
+				}
+				else if constexpr (std::same_as<T, Rect>)
+				{
+					return token->rect;
+				}
+				else
+				{
+					static_assert(std::same_as<T, Action::EasingFunction>, "Unsupported parameter type.");
+					return EasingTable[token->easing];
+				}
+			}
+		}
+
+		throw Error(U"Invalid format of parameter (index: {}). Expected `{}`."_fmt(index, Unicode::Widen(typeid(T).name())));
+	}
+
+	/// @brief タプル型 TTuple の各要素を、JSON 配列の同じ位置の値から読む
+	template <typename TTuple, size_t... Is>
+	TTuple ParseTuple(const JSON &paramData, std::index_sequence<Is...>)
+	{
+		return TTuple{ ParseValue<std::tuple_element_t<Is, TTuple>>(paramData[Is], Is)... };
+	}
+
+	/// @brief `Action::Generic` の I 番目の型としてパラメータを読む
+	template <size_t I>
+	Action::Generic ParseAlternative(const JSON &paramData)
+	{
+		using TSignature = std::variant_alternative_t<I, Action::Generic>;
+
+		// `bound` は引数を取らない
+		if constexpr (std::same_as<TSignature, std::monostate>)
+		{
+			return std::monostate{};
+		}
+		else
+		{
+			constexpr size_t Size = std::tuple_size_v<TSignature>;
+
+			if ((not paramData.isArray()) or (paramData.size() != Size))
+			{
+				throw Error(U"`params` must be an array of length {}. (Type: {})"_fmt(Size, Unicode::Widen(typeid(TSignature).name())));
+			}
+
+			return ParseTuple<TSignature>(paramData, std::make_index_sequence<Size>{});
+		}
+	}
+
+	/// @brief `Action::Generic::index()` ごとのパーサーの表
+	constexpr auto Parsers = []<size_t... Is>(std::index_sequence<Is...>)
+	{
+		return std::array<Action::Generic(*)(const JSON &), sizeof...(Is)>{ &ParseAlternative<Is>... };
+	}(std::make_index_sequence<std::variant_size_v<Action::Generic>>{});
+
+	/// @brief アクション名と、`Action::Generic` の中でそのオーバーロードが並んでいる範囲
+	struct ActionEntry
+	{
+		StringView name;
+
+		/// @brief オーバーロード 0 番の `Action::Generic` でのインデックス
+		size_t first;
+
+		/// @brief オーバーロードの数
+		size_t count;
+	};
+
+	/// @brief アクション名の表 `Action::Generic` の並び (monostate, Cross..., Appear..., AppearFromEdge...) と同じ順
+	constexpr std::array<ActionEntry, 4> Actions =
+	{ {
+		{ U"bound", 0, 1 },
+		{ U"cross", 1, Action::Cross::Count },
+		{ U"appear", 1 + Action::Cross::Count, Action::Appear::Count },
+		{ U"appearFromEdge", 1 + Action::Cross::Count + Action::Appear::Count, Action::AppearFromEdge::Count }
+	} };
+
+	static_assert(Actions.back().first + Actions.back().count == std::variant_size_v<Action::Generic>,
+		"`Actions` does not cover all alternatives of `Action::Generic`.");
+}
 
 namespace UFOCat::Core
 {
 	bool LevelData::IsDuration(const String &str)
 	{
-		// 文字列末尾が "s" だったら Duration ということに
-		return str.ends_with(U"s");
+		const auto token = Tokenize(str);
+		return token and token->kind == ParamToken::Kind::Duration;
 	}
 
 	bool LevelData::IsRect(const String &str)
 	{
-		// 正規表現で Rect と見なす
-		// (数字, 数字, 数字, 数字) の形 スペースの有無は問わない
-		const std::regex rectPattern{ R"(^\((\d+),\s*(\d+),\s*(\d+),\s*(\d+)\)$)" };
-		return std::regex_match(str.narrow(), rectPattern);
+		const auto token = Tokenize(str);
+		return token and token->kind == ParamToken::Kind::Rect;
 	}
 
 	bool LevelData::IsEasing(const String &str)
 	{
-		// 文字列戦闘が "e_" で始まっていたらイージング関数の名前ということに
-		return str.substr(0, 2) == U"e_";
+		const auto token = Tokenize(str);
+		return token and token->kind == ParamToken::Kind::Easing;
 	}
 
 	Duration LevelData::ParseDuration(const String &str)
 	{
-		// せっかく定義した Isなんちゃら を使おうと思ったけど、たかが１行なので直書きで
-		if (str.ends_with(U"s"))
+		if (const auto token = Tokenize(str);
+			token and token->kind == ParamToken::Kind::Duration)
 		{
-			// "s" を削除 -> double にパース -> Duration のコンストラクタに渡す
-			return Duration{ ParseFloat<double>(str.removed(U"s")) };
+			return Duration{ token->seconds };
 		}
 		else
 		{
@@ -39,25 +402,10 @@ namespace UFOCat::Core
 
 	Rect LevelData::ParseRect(const String &str)
 	{
-		// s3d::String から std::string への変換
-		std::string cast = str.narrow();
-
-		// IsRect と同じ正規表現パターンを用意
-		const std::regex rectPattern{ R"(^\((\d+),\s*(\d+),\s*(\d+),\s*(\d+)\)$)" };
-
-		// マッチ結果を格納する変数を作って、パターンを検証
-		if (std::smatch match;
-			std::regex_match(cast, match, rectPattern))
+		if (const auto token = Tokenize(str);
+			token and token->kind == ParamToken::Kind::Rect)
 		{
-			return Rect
-			{
-				// match[1]以降が、部分パターンに適合した文字列を格納してるので
-				// それ以降をそれぞれ整数に変換して Rect の位置、幅と高さにする
-				static_cast<int32>(std::stoi(match[1].str())),
-				static_cast<int32>(std::stoi(match[2].str())),
-				static_cast<int32>(std::stoi(match[3].str())),
-				static_cast<int32>(std::stoi(match[4].str()))
-			};
+			return token->rect;
 		}
 		else
 		{
@@ -67,59 +415,176 @@ namespace UFOCat::Core
 
 	Action::EasingFunction LevelData::ParseEasing(const String &str)
 	{
-		if (str.substr(0, 2) == U"e_")
+		if (not str.starts_with(U"e_"))
 		{
-			// "e_" を削除し、小文字にして表記揺れ統一
-			const auto& removed = str.substr(2).lowercased();
+			throw Error(U"Prefix of easing function `e_` is not found.");
+		}
 
-			if (removed == U"back")
-			{
-				return Easing::Back;
-			}
-			else if (removed == U"bounce")
-			{
-				return Easing::Bounce;
-			}
-			else if (removed == U"circ")
-			{
-				return Easing::Circ;
-			}
-			else if (removed == U"cubic")
-			{
-				return Easing::Cubic;
-			}
-			else if (removed == U"elastic")
-			{
-				return Easing::Elastic;
-			}
-			else if (removed == U"expo")
-			{
-				return Easing::Expo;
-			}
-			else if (removed == U"Linear")
+		if (const auto token = Tokenize(str);
+			token and token->kind == ParamToken::Kind::Easing)
+		{
+			return EasingTable[token->easing];
+		}
+		else
+		{
+			throw Error(U"`{}` is not registered as easing function."_fmt(str.substr(2)));
+		}
+	}
+
+	uint8 LevelData::GetEasingId(const Action::EasingFunction &func)
+	{
+		// std::function の中身が関数ポインタなら取り出す
+		// Siv3D のイージング関数は noexcept なので、両方の型で試す
+		EasingPointer pointer = nullptr;
+
+		if (const auto target = func.target<double(*)(double) noexcept>())
+		{
+			pointer = *target;
+		}
+		else if (const auto target = func.target<EasingPointer>())
+		{
+			pointer = *target;
+		}
+
+		for (size_t i = 0; i < EasingTable.size(); ++i)
+		{
+			if (pointer and (EasingTable[i] == pointer))
 			{
-				return Easing::Linear;
+				return static_cast<uint8>(i);
 			}
-			else if (removed == U"quad")
+		}
+
+		throw Error(U"The easing function is not one of Siv3D's builtin easings.");
+	}
+
+	Action::EasingFunction LevelData::GetEasingFromId(uint8 id)
+	{
+		if (id < EasingTable.size())
+		{
+			return EasingTable[id];
+		}
+
+		throw Error(U"Easing id {} is out of range. (valid range: 0 ~ {})"_fmt(id, EasingTable.size() - 1));
+	}
+
+	StringView LevelData::GetActionName(size_t index)
+	{
+		for (const auto &action : Actions)
+		{
+			if ((action.first <= index) and (index < action.first + action.count))
 			{
-				return Easing::Quad;
+				return action.name;
 			}
-			else if (removed == U"Quart")
+		}
+
+		throw Error(U"Action index is out of range of `Action::Generic`.");
+	}
+
+	Action::Generic LevelData::ParseAction(StringView name, size_t overload, const JSON &paramData)
+	{
+		for (const auto &action : Actions)
+		{
+			if (action.name != name)
 			{
-				return Easing::Quart;
+				continue;
 			}
-			else if (removed == U"sine")
+
+			if (overload >= action.count)
 			{
-				return Easing::Sine;
+				throw Error(U"`{}` overload index is invalid. (valid range: 0 ~ {})"_fmt(name, action.count - 1));
 			}
-			else
+
+			return Parsers[action.first + overload](paramData);
+		}
+
+		throw Error(U"`{}` is not registered as action (method) name."_fmt(name));
+	}
+
+	LevelData LevelData::Parse(const JSON &level)
+	{
+		if (not level.isObject())
+		{
+			throw Error(U"Level data is not object type.");
+		}
+
+		/*
+		 * 以後、JSONから抽出する仮の文字列格納用変数は data_ で始める
+		 * JSONのプロパティ値が
+		 *	数値型の場合はs3d::JSON の get<uint32>() を使ってパース
+		 *	文字列型の場合は、複数の型表現を包括しているため
+		 *	 一旦 getString() で文字列として取得し、
+		 *	 Duration や Rect、EasingFunction に変換する
+		 */
+
+		// 1レベルの時間制限
+		Duration timeLimit = LevelData::ParseDuration(level[U"timeLimit"].get<String>());
+
+		// 類似度
+		uint32 similarity = level[U"similarity"].get<uint32>();
+
+		// 品種
+		LevelData::BreedData breedData{ };
+
+		// 品種データを読み込む
+		if (const auto& data_breedData = level[U"breedData"];
+			data_breedData.isObject())
+		{
+			breedData.similar = data_breedData[U"similar"].get<uint32>();
+			breedData.other = data_breedData[U"other"].get<uint32>();
+		}
+		else
+		{
+			throw Error(U"`breedData` is not object type.");
+		}
+
+		// 出現ペース
+		LevelData::IntervalData intervalData{ };
+
+		// 出現ペースのデータを読み込む
+		if (const auto& data_intervalData = level[U"intervalData"];
+			data_intervalData.isObject())
+		{
+			intervalData.count = data_intervalData[U"count"].get<uint32>();
+			intervalData.period = LevelData::ParseDuration(data_intervalData[U"period"].getString());
+		}
+		else
+		{
+			throw Error(U"`intervalData` is not object type.");
+		}
+
+		// このレベルでの使用アクション
+		Array<LevelData::ActionData> actionDataList{ };
+
+		// 配列であることを確認してからアクションデータを全走査
+		if (const auto& data_actionData = level[U"actionData"];
+			data_actionData.isArray())
+		{
+			for (const auto& md : data_actionData)
 			{
-				throw Error(U"`{}` is not registered as easing function."_fmt(removed));
+				// アクション名（メソッド名）
+				const String name = md.value[U"name"].getString();
+
+				// オーバーロード番号（何がどれに対応するかは、`cact` 参照）
+				const size_t overload = md.value[U"overload"].get<size_t>();
+
+				// `params` プロパティを格納する仮変数
+				const auto& data_params = md.value[U"params"];
+
+				// 発生確率
+				const double probability = md.value[U"probability"].get<double>();
+
+				// (name, overload) に対応するパーサーを表から引いて、実際の引数として使えるタプルにする
+				const Action::Generic params = LevelData::ParseAction(name, overload, data_params);
+
+				// アクションデータのパース1周したら、リストに追加
+				actionDataList << LevelData::ActionData{ name, params, probability };
 			}
 		}
 		else
 		{
-			throw Error(U"Prefix of easing function `e_` is not found.");
+			throw Error(U"`actionData` is not array type.");
 		}
+
+		return LevelData{ timeLimit, similarity, breedData, intervalData, actionDataList };
 	}
 }
@@ -95,11 +95,12 @@ namespace UFOCat::Core
 		static bool IsDuration(const String& str);
 
 		/// @brief 文字列が Rect 型に変換可能かどうかを返す
+		/// @note (数字, 数字, 数字, 数字) の形 スペースの有無は問わない
 		/// @param str 対象文字列
 		/// @return 変換可能なら `true`
 		static bool IsRect(const String& str);
 
-		/// @brief 文字列が Siv3D 規定のイージング関数として見なせるかどうかを返す
+		/// @brief 文字列が Siv3D 規定のイージング関数の名前かどうかを返す
 		/// @param str 対象文字列
 		/// @return 変換可能なら `true`
 		static bool IsEasing(const String& str);
@@ -119,95 +120,34 @@ namespace UFOCat::Core
 		/// @return 変換したイージング関数のオブジェクト、変換できなければ例外が投げられる
 		static Action::EasingFunction ParseEasing(const String &str);
 
-		/// @brief JSON 配列に対して指定したタプル型 TTuple に対応する値を検証して、アクションの引数として取りうる型およびその要素が入った std::tuple に変換する（中身が std::variant）@n
-		/// paramData は アクションを実行するための引数情報を JSON 配列として表現したものであることが想定されており、その各要素を制約通りにパースした結果をタプルとして返す @n
-		/// このタプルを展開して CatObject のアクションメソッドに渡すことで、** JSON データからアクションを実行できるようになる **
-		/// @tparam TTuple 変換したい引数の構成となるタプル型 名前空間 `cact` に定義されている各アクション（`bound` 以外）のシグネチャを指定する
-		/// @param paramData 解析対象の JSON 配列 TTupleの要素数と一致していなければならない @n
-		/// 各要素は: 数値 (uint32 として扱う)、文字列 (Duration, Rect, または Action::EasingFunction を表す形式)、または長さ4の配列 (std::array<double,4>) であることが期待され、合わない場合は例外を投げる
-		/// @return 各要素が TTuple に合う形で構成した tuple（中身 variant） @n 配列の長さや各要素の型が期待と一致しない場合は例外を投げる
-		template <Action::ValidSignature TTuple>
-		static auto ParseParameters(const JSON &paramData)
-		{
-			// JSON 配列の長さと 希望のタプル型の要素数が一致していなかったらエラー
-			if (paramData.size() != std::tuple_size_v<TTuple>)
-			{
-				throw Error(U"Specified `paramData` (JSON data) and TTuple is not match length.\n`paramData.size()`: {} - `{}` length: {}"_fmt(paramData.size(), Unicode::Widen(std::string(typeid(TTuple).name())), std::tuple_size_v<TTuple>));
-			}
-
-			// 一時的に各要素を取りうる型の variant で格納する配列（長さは TTuple 分）
-			std::array<
-				std::variant<
-					uint32,
-					Duration,
-					Rect,
-					Action::EasingFunction,
-					std::array<double, 4>
-				>,
-				std::tuple_size_v<TTuple>
-			> temp;
-
-			// 各要素を検証しながら対応する位置の temp に格納していく
-			for (size_t i = 0; i < std::tuple_size_v<TTuple>; i++)
-			{
-				if (paramData[i].isNumber())
-				{
-					temp[i] = paramData[i].get<uint32>();
-				}
-				else if (paramData[i].isString())
-				{
-					const String& parsed = paramData[i].getString();
-
-					if (IsDuration(parsed))
-					{
-						temp[i] = ParseDuration(parsed);
-					}
-					else if (IsRect(parsed))
-					{
-						temp[i] = ParseRect(parsed);
-					}
-					else if (IsEasing(parsed))
-					{
-						temp[i] = ParseEasing(parsed);
-					}
-					else
-					{
-						throw Error(U"Failed to parse parameter. (Type: {}, ParamIndex: {})"_fmt(Unicode::FromUTF8(typeid(TTuple).name()), i));
-					}
-				}
-				// 配列だった場合特殊ということにしておく
-				// `appearFromEdge` の `overflow` でしか配列を引数にとらない
-				// そのため、サイズ4の配列を決め打ちで渡して問題はないはず（`overflow` の仕様は `CatObject.hpp` を参照）
-				else if (paramData[i].isArray())
-				{
-					std::array<double, 4> overflow{};
-
-					if (paramData[i].size() == 4)
-					{
-						for (size_t j = 0; j < 4; j++)
-						{
-							overflow[j] = paramData[i][j].get<double>();
-						}
-						temp[i] = overflow;
-					}
-					else
-					{
-						throw Error(U"Invalid array parameter. `appearFromEdge`'s parameter is allowed [double, double, double, double].");
-					}
-				}
-				else
-				{
-					throw Error(U"Invalid format of parameter (index: {}) in JSON "_fmt(i));
-				}
-			}
-
-			// temp の各要素を取り出してタプルに変換したのを返す
-			// apply はパラメータパックを使って展開できるからこれが便利
-			return std::apply([](auto &&...args)
-			{
-				return std::make_tuple(args...);
-			}, temp);
-		}
-		// 戻り値が auto のせいでテンプレート外で定義できないので、この関数だけヘッダーに定義を書いています
+		/// @brief イージング関数を、キャッシュなどに保存するための番号に変換する
+		/// @param func `ParseEasing()` で作ったイージング関数
+		/// @return 番号 Siv3D 規定のイージング関数でなければ例外が投げられる
+		static uint8 GetEasingId(const Action::EasingFunction &func);
+
+		/// @brief `GetEasingId()` で得た番号からイージング関数を復元する
+		/// @param id 番号
+		/// @return イージング関数のオブジェクト、範囲外の番号なら例外が投げられる
+		static Action::EasingFunction GetEasingFromId(uint8 id);
+
+		/// @brief `Action::Generic` が保持している型のインデックスから、対応するアクション名（メソッド名）を取得する
+		/// @param index `Action::Generic::index()` の値
+		/// @return アクション名 範囲外なら例外が投げられる
+		static StringView GetActionName(size_t index);
+
+		/// @brief `level_data.json` の `data` 配列の要素1つ（1レベル分）をパースする
+		/// @param level 1レベル分の JSON オブジェクト
+		/// @return パースしたレベルデータ 形式が合わない場合は例外を投げる
+		static LevelData Parse(const JSON &level);
+
+		/// @brief アクション名とオーバーロード番号に対応するパラメータを JSON 配列からパースする @n
+		/// (name, overload) ごとのパーサーは `Action.hpp` のタプル型からコンパイル時に生成した表にあり、
+		/// 名前の区切りと番号から表のインデックスを計算して呼び出す @n
+		/// 各要素はタプル型から期待される型として読むので、文字列を総当たりで判定することはない
+		/// @param name アクション名（`CatObject` のメソッド名と同じ）
+		/// @param overload オーバーロード番号（何がどれに対応するかは `Action.hpp` 参照）
+		/// @param paramData 解析対象の JSON 配列 `bound` の場合は無視される
+		/// @return パースしたパラメータ 名前や番号、配列の長さや各要素の型が合わない場合は例外を投げる
+		static Action::Generic ParseAction(StringView name, size_t overload, const JSON &paramData);
 	};
 }
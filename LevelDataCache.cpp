@@ -0,0 +1,289 @@
+﻿# include "LevelDataCache.hpp"
+
+namespace
+{
+	using namespace UFOCat;
+	using namespace UFOCat::Core;
+
+	/// @brief キャッシュファイルの先頭に置く情報
+	struct Header
+	{
+		uint32 magic;
+		uint32 version;
+		/// @brief `Action::Generic` の型の数 アクションのシグネチャが増減したら読み込まない
+		uint32 signatureCount;
+		uint32 levelCount;
+		uint64 sourceHash;
+	};
+
+	/// @brief メモリマップされたキャッシュを先頭から順に読んでいくためのカーソル
+	class Reader
+	{
+	private:
+		const Byte *m_current;
+
+		const Byte *m_end;
+
+	public:
+		Reader(const Byte *data, size_t size)
+			: m_current{ data }
+			, m_end{ data + size }
+		{}
+
+		/// @brief 値を1つ読み込んで、その分カーソルを進める
+		/// @tparam T 読み込む型（トリビアルコピー可能なもの）
+		/// @return 読み込んだ値 ファイルの終わりを越える場合は例外が投げられる
+		template <typename T>
+		T read()
+		{
+			if (static_cast<size_t>(m_end - m_current) < sizeof(T))
+			{
+				throw Error{ U"Level data cache is truncated." };
+			}
+
+			T value;
+			std::memcpy(&value, m_current, sizeof(T));
+			m_current += sizeof(T);
+			return value;
+		}
+
+		/// @brief 最後まで読み込んだかどうか
+		bool isEnd() const noexcept
+		{
+			return m_current == m_end;
+		}
+	};
+
+	/* -- 引数1つ分の書き込み / 読み込み -- */
+
+	void WriteValue(BinaryWriter &writer, uint32 value)
+	{
+		writer.write(value);
+	}
+
+	void WriteValue(BinaryWriter &writer, const Duration &value)
+	{
+		writer.write(value.count());
+	}
+
+	void WriteValue(BinaryWriter &writer, const Rect &value)
+	{
+		writer.write(std::array<int32, 4>{ value.x, value.y, value.w, value.h });
+	}
+
+	void WriteValue(BinaryWriter &writer, const Action::EasingFunction &value)
+	{
+		writer.write(LevelData::GetEasingId(value));
+	}
+
+	void WriteValue(BinaryWriter &writer, const std::array<double, 4> &value)
+	{
+		writer.write(value);
+	}
+
+	template <typename T>
+	T ReadValue(Reader &reader)
+	{
+		if constexpr (std::same_as<T, uint32> or std::same_as<T, std::array<double, 4>>)
+		{
+			return reader.read<T>();
+		}
+		else if constexpr (std::same_as<T, Duration>)
+		{
+			return Duration{ reader.read<double>() };
+		}
+		else if constexpr (std::same_as<T, Rect>)
+		{
+			const auto [x, y, w, h] = reader.read<std::array<int32, 4>>();
+			return Rect{ x, y, w, h };
+		}
+		else if constexpr (std::same_as<T, Action::EasingFunction>)
+		{
+			return LevelData::GetEasingFromId(reader.read<uint8>());
+		}
+		else
+		{
+			static_assert(not std::same_as<T, T>, "This parameter type cannot be cached.");
+		}
+	}
+
+	/// @brief タプルの各要素を順番に読み込む
+	/// @note 波括弧での初期化は左から順に評価されるので、書き込んだ順に読める
+	template <typename TTuple, size_t... Is>
+	TTuple ReadTuple(Reader &reader, std::index_sequence<Is...>)
+	{
+		return TTuple{ ReadValue<std::tuple_element_t<Is, TTuple>>(reader)... };
+	}
+
+	/// @brief `Action::Generic` の I 番目の型として引数を読み込む
+	template <size_t I>
+	Action::Generic ReadParams(Reader &reader)
+	{
+		using TSignature = std::variant_alternative_t<I, Action::Generic>;
+
+		if constexpr (std::same_as<TSignature, std::monostate>)
+		{
+			return std::monostate{};
+		}
+		else
+		{
+			return ReadTuple<TSignature>(reader, std::make_index_sequence<std::tuple_size_v<TSignature>>{});
+		}
+	}
+
+	/// @brief `Action::Generic::index()` から、その型の引数を読み込む関数を引くための表
+	constexpr auto ParamsReaders = []<size_t... Is>(std::index_sequence<Is...>)
+	{
+		return std::array<Action::Generic(*)(Reader &), sizeof...(Is)>{ &ReadParams<Is>... };
+	}(std::make_index_sequence<std::variant_size_v<Action::Generic>>{});
+}
+
+namespace UFOCat::Core
+{
+	FilePath LevelDataCache::GetPath(FilePathView jsonPath)
+	{
+		return FilePath{ jsonPath } + U".cache";
+	}
+
+	Optional<Array<LevelData>> LevelDataCache::Load(FilePathView path, uint64 sourceHash)
+	{
+		if (not FileSystem::IsFile(path))
+		{
+			return none;
+		}
+
+		MemoryMappedFileView view{ path };
+
+		if (not view)
+		{
+			return none;
+		}
+
+		const auto mapped = view.mapAll();
+
+		try
+		{
+			Reader reader{ mapped.data, mapped.size };
+
+			if (const auto header = reader.read<Header>();
+				header.magic != Magic
+				or header.version != Version
+				or header.signatureCount != std::variant_size_v<Action::Generic>
+				or header.sourceHash != sourceHash)
+			{
+				return none;
+			}
+			else
+			{
+				Array<LevelData> levels(Arg::reserve = header.levelCount);
+
+				for (uint32 i = 0; i < header.levelCount; ++i)
+				{
+					const Duration timeLimit{ reader.read<double>() };
+					const uint32 similarity = reader.read<uint32>();
+
+					LevelData::BreedData breedData{};
+					breedData.similar = reader.read<uint32>();
+					breedData.other = reader.read<uint32>();
+
+					LevelData::IntervalData intervalData{};
+					intervalData.count = reader.read<uint32>();
+					intervalData.period = Duration{ reader.read<double>() };
+
+					const uint32 actionCount = reader.read<uint32>();
+					Array<LevelData::ActionData> actionDataList(Arg::reserve = actionCount);
+
+					for (uint32 j = 0; j < actionCount; ++j)
+					{
+						const uint8 index = reader.read<uint8>();
+						const double probability = reader.read<double>();
+
+						if (index >= ParamsReaders.size())
+						{
+							return none;
+						}
+
+						// 名前は型のインデックスから決まるので保存していない
+						actionDataList << LevelData::ActionData{ String{ LevelData::GetActionName(index) }, ParamsReaders[index](reader), probability };
+					}
+
+					levels << LevelData{ timeLimit, similarity, breedData, intervalData, actionDataList };
+				}
+
+				// 余計なデータが残っていたら壊れているとみなす
+				if (not reader.isEnd())
+				{
+					return none;
+				}
+
+				return levels;
+			}
+		}
+		catch ([[maybe_unused]] const Error &error)
+		{
+# if _DEBUG
+			Logger << U"[LevelDataCache] `{}` is broken: {}"_fmt(path, error.what());
+# endif
+			return none;
+		}
+	}
+
+	bool LevelDataCache::Save(FilePathView path, uint64 sourceHash, const Array<LevelData> &levels)
+	{
+		BinaryWriter writer{ path };
+
+		if (not writer)
+		{
+			return false;
+		}
+
+		try
+		{
+			m_write(writer, sourceHash, levels);
+		}
+		catch ([[maybe_unused]] const Error &error)
+		{
+			// 書きかけのキャッシュは残さない
+			writer.close();
+			FileSystem::Remove(path);
+
+# if _DEBUG
+			Logger << U"[LevelDataCache] Failed to write `{}`: {}"_fmt(path, error.what());
+# endif
+			return false;
+		}
+
+		return true;
+	}
+
+	void LevelDataCache::m_write(BinaryWriter &writer, uint64 sourceHash, const Array<LevelData> &levels)
+	{
+		writer.write(Header{ Magic, Version, static_cast<uint32>(std::variant_size_v<Action::Generic>), static_cast<uint32>(levels.size()), sourceHash });
+
+		for (const auto &level : levels)
+		{
+			writer.write(level.timeLimit.count());
+			writer.write(level.similarity);
+			writer.write(level.breedData.similar);
+			writer.write(level.breedData.other);
+			writer.write(level.intervalData.count);
+			writer.write(level.intervalData.period.count());
+			writer.write(static_cast<uint32>(level.actionDataList.size()));
+
+			for (const auto &action : level.actionDataList)
+			{
+				writer.write(static_cast<uint8>(action.params.index()));
+				writer.write(action.probability);
+
+				// 型のインデックスが分かれば、各要素の型と並びも決まるので値だけを書く
+				std::visit([&writer](const auto &params)
+				{
+					if constexpr (not std::same_as<std::remove_cvref_t<decltype(params)>, std::monostate>)
+					{
+						std::apply([&writer](const auto &...args) { (WriteValue(writer, args), ...); }, params);
+					}
+				}, action.params);
+			}
+		}
+	}
+}
@@ -0,0 +1,44 @@
+﻿# pragma once
+# include "LevelData.hpp"
+
+namespace UFOCat::Core
+{
+	/// @brief `level_data.json` をパースした結果をバイナリで保存し、次回起動時にメモリマップで読み込むためのキャッシュ @n
+	/// 元の JSON のハッシュ値を一緒に保存しておき、JSON が書き換えられていたら使わない
+	/// @note アクション名やイージング関数は番号で持っているので、読み込むときに文字列のパースは一切行わない
+	class LevelDataCache
+	{
+	private:
+		/// @brief ヘッダーと全てのレベルデータを書き込む
+		/// @param writer 書き込み先
+		/// @param sourceHash 元の JSON のハッシュ値
+		/// @param levels 全てのレベルデータ
+		/// @remarks 保存できないイージング関数などがあれば例外が投げられる
+		static void m_write(BinaryWriter &writer, uint64 sourceHash, const Array<LevelData> &levels);
+
+	public:
+		/// @brief ファイル先頭の識別子 ("UFLC")
+		constexpr static uint32 Magic = 0x434C4655;
+
+		/// @brief フォーマットのバージョン 書き込む内容を変えたら増やす
+		constexpr static uint32 Version = 1;
+
+		/// @brief JSON ファイルに対応するキャッシュファイルのパスを取得する
+		/// @param jsonPath JSON ファイルのパス
+		/// @return 同じフォルダに置く `.cache` ファイルのパス
+		static FilePath GetPath(FilePathView jsonPath);
+
+		/// @brief キャッシュを読み込む
+		/// @param path キャッシュファイルのパス
+		/// @param sourceHash 今の JSON のハッシュ値
+		/// @return 全てのレベルデータ ファイルがない、壊れている、ハッシュ値が一致しないなどの場合は `none`
+		static Optional<Array<LevelData>> Load(FilePathView path, uint64 sourceHash);
+
+		/// @brief キャッシュを書き込む
+		/// @param path キャッシュファイルのパス
+		/// @param sourceHash 元の JSON のハッシュ値
+		/// @param levels パースに成功した全てのレベルデータ
+		/// @return 書き込めたら `true`
+		static bool Save(FilePathView path, uint64 sourceHash, const Array<LevelData> &levels);
+	};
+}
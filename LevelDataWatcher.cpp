@@ -0,0 +1,106 @@
+﻿# include "LevelDataWatcher.hpp"
+
+namespace UFOCat::Core
+{
+	LevelDataWatcher::LevelDataWatcher(FilePathView path)
+		: m_path{ FileSystem::FullPath(path) }
+		, m_watcher{ FileSystem::ParentPath(m_path) }
+	{
+		if (const auto entries = m_getEntries(JSON::Load(m_path)))
+		{
+			m_entries = entries->map([](const JSON &entry) { return entry.formatMinimum(); });
+		}
+	}
+
+	Optional<Array<JSON>> LevelDataWatcher::m_getEntries(const JSON &json)
+	{
+		if ((not json) or (not json[U"data"].isArray()))
+		{
+			return none;
+		}
+
+		// ParseLevelData() と同じく、オブジェクトでない要素は飛ばす
+		Array<JSON> entries;
+
+		for (const auto &entry : json[U"data"].arrayView())
+		{
+			if (entry.isObject())
+			{
+				entries << entry;
+			}
+		}
+
+		return entries;
+	}
+
+	Optional<Array<LevelData>> LevelDataWatcher::poll(const Array<LevelData> &current)
+	{
+		if (not m_watcher)
+		{
+			return none;
+		}
+
+		// 監視しているフォルダの変更のうち、JSON ファイルに関するものがあるか
+		const bool isModified = m_watcher.retrieveChanges().any([this](const FileChange &change)
+		{
+			// エディタによっては一時ファイルからの名前変更で保存される
+			return (change.action == FileAction::Added or change.action == FileAction::Modified or change.action == FileAction::RenamedNewName)
+				and FileSystem::FullPath(change.path) == m_path;
+		});
+
+		if (not isModified)
+		{
+			return none;
+		}
+
+		// 保存途中などで JSON が壊れていることもあるので、その場合は前のデータのまま
+		const auto entries = m_getEntries(JSON::Load(m_path));
+
+		if ((not entries) or entries->isEmpty())
+		{
+			Logger << U"[LevelDataWatcher] `{}` is invalid. Keeping the last good data."_fmt(m_path);
+			return none;
+		}
+
+		Array<String> minified = entries->map([](const JSON &entry) { return entry.formatMinimum(); });
+		Array<LevelData> levels(Arg::reserve = entries->size());
+		size_t reparsed = 0;
+
+		try
+		{
+			for (size_t i = 0; i < entries->size(); ++i)
+			{
+				// 前回と同じ内容なら、パースせずにそのまま使う
+				if ((i < m_entries.size()) and (i < current.size()) and (minified[i] == m_entries[i]))
+				{
+					levels << current[i];
+					continue;
+				}
+
+				levels << LevelData::Parse((*entries)[i]);
+				++reparsed;
+
+				// 同じ位置のレベルのクリア状況は引き継ぐ
+				if (i < current.size())
+				{
+					levels.back().isCleared = current[i].isCleared;
+				}
+			}
+		}
+		catch (const Error &error)
+		{
+			Logger << U"[LevelDataWatcher] Failed to parse `{}`: {} Keeping the last good data."_fmt(m_path, error.what());
+			return none;
+		}
+
+		if ((reparsed == 0) and (levels.size() == current.size()))
+		{
+			return none;
+		}
+
+		Logger << U"[LevelDataWatcher] Reloaded {} level(s). ({} levels in total)"_fmt(reparsed, levels.size());
+
+		m_entries = std::move(minified);
+		return levels;
+	}
+}
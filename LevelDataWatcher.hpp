@@ -0,0 +1,41 @@
+﻿# pragma once
+# include "LevelData.hpp"
+
+namespace UFOCat::Core
+{
+	/// @brief `level_data.json` の変更を監視し、変更があったレベルだけをパースし直すためのクラス @n
+	/// 前回読み込んだときの `data` 配列の各要素を保存しておき、新しい JSON の要素と1つずつ比べる
+	class LevelDataWatcher
+	{
+	private:
+		/// @brief 監視している JSON ファイルのフルパス
+		FilePath m_path;
+
+		/// @brief JSON ファイルがあるフォルダの監視
+		DirectoryWatcher m_watcher;
+
+		/// @brief 前回読み込んだときの `data` 配列の各要素（空白などを除いた文字列）
+		Array<String> m_entries;
+
+		/// @brief JSON の `data` 配列から、レベルとして扱う要素（オブジェクト）だけを取り出す
+		/// @param json `level_data.json` の形式の JSON
+		/// @return 各要素の JSON `data` が配列でなければ `none`
+		static Optional<Array<JSON>> m_getEntries(const JSON &json);
+
+	public:
+		/// @brief デフォルトコンストラクタ 何も監視しない
+		LevelDataWatcher() = default;
+
+		/// @brief JSON ファイルの監視を始める
+		/// @param path JSON ファイルのパス
+		/// @remarks 今の JSON の内容を、比較の基準として保存しておく
+		explicit LevelDataWatcher(FilePathView path);
+
+		/// @brief JSON ファイルが変更されていれば、読み込み直して新しいレベルデータを作る @n
+		/// 前回と同じ内容の要素は `current` の同じ位置のものをそのまま使い、変わった要素だけパースする
+		/// @param current 今使っているレベルデータ（前回読み込んだ内容に対応するもの）
+		/// @return 新しいレベルデータ 変更がない場合や、JSON やパースにエラーがあった場合は `none`
+		/// @remarks エラーがあった場合は基準を更新しないので、JSON を直せば次の変更で読み込み直される
+		Optional<Array<LevelData>> poll(const Array<LevelData> &current);
+	};
+}
@@ -0,0 +1,92 @@
+﻿# include "LevelPlan.hpp"
+
+namespace UFOCat::Core
+{
+	LevelPlan LevelPlan::Create(const LevelData &level, size_t levelIndex, const SimilarityMatrix &similarities, size_t targetIndex, const Size &sceneSize, DefaultRNG &rng)
+	{
+		LevelPlan plan;
+		plan.levelIndex = levelIndex;
+		plan.targetIndex = targetIndex;
+
+		// レベルデータのうち、登場する猫の数に関するデータを取得する
+		const size_t similarCount = level.breedData.similar;
+		const size_t otherCount = level.breedData.other;
+		const size_t similarity = level.similarity;
+
+		// 類似度ごとに振り分けた猫の ID の列は、読み込み時に作ってあるのでそこから選ぶ
+		// どれも連続した範囲を1度なめるだけで、全種類の走査やシャッフルはしない
+
+		// ターゲットと類似度がちょうど similarity の猫から、既定 (similarCount) の数だけ選ぶ
+		Array<size_t> ids = SimilarityMatrix::Sample(similarities.equalTo(targetIndex, similarity), similarCount, rng);
+
+		// 少なすぎる場合は、条件を緩和して補う
+		if (ids.size() < similarCount and similarity > 0)
+		{
+			// 類似度を1つ下げたものから補い、
+			ids.append(SimilarityMatrix::Sample(similarities.equalTo(targetIndex, similarity - 1), similarCount - ids.size(), rng));
+
+			// それでも足りなければ、さらに類似度の低いもの全体から補う
+			if (ids.size() < similarCount)
+			{
+				ids.append(SimilarityMatrix::Sample(similarities.lessThan(targetIndex, similarity - 1), similarCount - ids.size(), rng));
+			}
+		}
+
+		// 類似条件を下回るのを「その他」として、似ている猫として選んだもの以外から選ぶ
+		// 既定の数に達しない場合は、それでもよしとする
+		// 無理にほかの種類も含めようとすると、難易度が上がりすぎる可能性がある？
+		ids.append(SimilarityMatrix::Sample(similarities.lessThan(targetIndex, similarity), otherCount, rng, HashSet<size_t>{ ids.begin(), ids.end() }));
+
+		// それぞれの範囲は重ならないので、ここまでで重複はない
+		plan.selectionIndices = std::move(ids);
+
+		// レベル中に行うアクションリストの中から、それぞれの発生確率だけを抜き取ったリストで確率分布をつくる
+		plan.actionProbabilities = DiscreteDistribution{ level.actionDataList.map([](const LevelData::ActionData &data) { return data.probability; }) };
+
+		// ターゲットの出現時刻を、レベルに応じてランダムに決める 定式の詳細は仕様書参照
+		const double term1 = level.timeLimit.count() / Random(2, 4, rng);
+		const double term2 = (levelIndex + 1) * (level.breedData.total() * level.intervalData.period.count()) / (level.actionDataList.size() * level.breedData.similar);
+		plan.targetAppearTime = Duration{ Min((term1 + term2), 0.75 * level.timeLimit.count()) };
+
+		plan.seed = RandomUint64(rng);
+
+		// スポーンの時刻、猫、アクション、速度を全て決めておく
+		// 制限時間の前に BGM 再生までの猶予 1.75s があり、その間もスポーンは続く
+		const double playTime = level.timeLimit.count() + 1.75;
+		const double period = level.intervalData.period.count();
+		const size_t phase = levelIndex + 1;
+		const double velocityFactor = CatObject::VelocityFactor(phase);
+
+		// タイマーの残り時間がターゲットの出現時刻を下回ってから、最初のスポーンをターゲットにする
+		const double targetTime = playTime - plan.targetAppearTime.count();
+		bool hasTarget = false;
+
+		for (size_t tick = 1; (period > 0.0) and (tick * period <= playTime); ++tick)
+		{
+			const double time = tick * period;
+
+			if ((not hasTarget) and (time >= targetTime))
+			{
+				plan.spawns << Spawn{ time, TargetSelection, plan.actionProbabilities(rng), CatObject::RandomVelocity(phase, velocityFactor, sceneSize, rng) };
+				hasTarget = true;
+				continue;
+			}
+
+			// ターゲット以外の猫をランダムに指定個選ぶ
+			for (uint32 i = 0; (i < level.intervalData.count) and (not plan.selectionIndices.isEmpty()); ++i)
+			{
+				plan.spawns << Spawn{ time, Random<size_t>(0, plan.selectionIndices.size() - 1, rng), plan.actionProbabilities(rng), CatObject::RandomVelocity(phase, velocityFactor, sceneSize, rng) };
+			}
+		}
+
+		// ターゲットは 0 番目の枠を上書きするので、スポーンの数に関係なく1つ分の枠がある
+		plan.peakSpawnCount = (plan.spawns.size() - (hasTarget ? 1 : 0)) + 1;
+
+		return plan;
+	}
+
+	bool LevelPlan::isFor(size_t level, size_t target) const noexcept
+	{
+		return (levelIndex == level) and (targetIndex == target);
+	}
+}
@@ -0,0 +1,75 @@
+﻿# pragma once
+# include "LevelData.hpp"
+# include "SimilarityMatrix.hpp"
+# include "CatObject.hpp"
+
+namespace UFOCat::Core
+{
+	/// @brief 次のレベルで使うもの（ターゲット、登場させる猫、アクションの抽選に使う確率分布）をまとめた計画 @n
+	/// `Wanted` シーンの開始時に作っておき、ターゲットを発表している間にテクスチャを読み込んでおく
+	struct LevelPlan
+	{
+		/// @brief 1回分のスポーン
+		struct Spawn
+		{
+			/// @brief スポーンさせる時刻（プレイ中になってからの経過時間） [s]
+			double time = 0.0;
+
+			/// @brief スポーンさせる猫の `selectionIndices` でのインデックス ターゲットなら `TargetSelection`
+			size_t selection = 0;
+
+			/// @brief 行わせるアクションの、レベルデータのアクションリストでのインデックス
+			size_t action = 0;
+
+			/// @brief 速度
+			Vec2 velocity{ 0, 0 };
+		};
+
+		/// @brief `Spawn::selection` でターゲットを表す値
+		constexpr static size_t TargetSelection = std::numeric_limits<size_t>::max();
+
+		/// @brief 計画したレベルのインデックス
+		/// @note このヘッダは `InvalidIndex` の定義より先に読み込まれるので、同じ値を直接書いている
+		size_t levelIndex = std::numeric_limits<size_t>::max();
+
+		/// @brief ターゲットの `GameData::cats` でのインデックス
+		size_t targetIndex = std::numeric_limits<size_t>::max();
+
+		/// @brief ターゲット以外に登場させる猫の `GameData::cats` でのインデックス（重複なし）
+		Array<size_t> selectionIndices;
+
+		/// @brief レベルデータのアクションリストの発生確率から作った確率分布
+		DiscreteDistribution actionProbabilities;
+
+		/// @brief ターゲットを出現させる時刻（タイマーの残り時間）
+		/// @remarks この時刻はあくまでスポーンのタイミングで使われるだけで、その時点ですぐにターゲットが視認できるとは限らない
+		Duration targetAppearTime{ 0 };
+
+		/// @brief レベル中の乱数（アクション中の動きなど）に使うシード値
+		uint64 seed = 0;
+
+		/// @brief レベル中の全てのスポーン 時刻の早い順に並ぶ
+		Array<Spawn> spawns;
+
+		/// @brief 同時に存在する猫の最大数（ターゲットの枠も含む）
+		/// @note スポーンした猫はレベルが終わるまで消えないので、全てのスポーンの数と同じになる
+		size_t peakSpawnCount = 0;
+
+		/// @brief レベルデータと類似度の表から計画を立てる @n
+		/// 乱数は全て `rng` から取るので、同じシード値で初期化した乱数生成器を渡せば同じ計画になる
+		/// @param level レベルデータ
+		/// @param levelIndex レベルのインデックス
+		/// @param similarities 全ての猫同士の類似度の表
+		/// @param targetIndex ターゲットの `GameData::cats` でのインデックス
+		/// @param sceneSize シーンの大きさ（猫の速度を決めるのに使う）
+		/// @param rng 使う乱数生成器
+		/// @return 計画
+		static LevelPlan Create(const LevelData &level, size_t levelIndex, const SimilarityMatrix &similarities, size_t targetIndex, const Size &sceneSize, DefaultRNG &rng);
+
+		/// @brief この計画が、指定したレベルとターゲットのものかどうか
+		/// @param level レベルのインデックス
+		/// @param target ターゲットのインデックス
+		/// @return 一致すれば `true`
+		bool isFor(size_t level, size_t target) const noexcept;
+	};
+}
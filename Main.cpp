@@ -1,5 +1,6 @@
 ﻿#include <Siv3D.hpp> // Siv3D v0.6.16
 # include "Common.hpp"
+# include "Boot.hpp"
 # include "Title.hpp"
 # include "Wanted.hpp"
 # include "Level.hpp"
@@ -9,11 +10,8 @@ using namespace UFOCat;
 
 void Main()
 {
-	// テクスチャフォルダから初めに全ての猫の画像を登録
-	for (auto &&[i, path] : Indexed(FileSystem::DirectoryContents(U"texture/cat")))
-	{
-		TextureAsset::Register(Cat(i), path);
-	}
+	// 起動してから操作できるようになるまでの時間を計る
+	const uint64 bootStartTime = Time::GetMicrosec();
 
 	// フォントアセットの登録
 	FontAsset::Register(Util::FontFamily::YuseiMagic, FontMethod::SDF, 48, U"font/YuseiMagic-Regular.ttf");
@@ -28,22 +26,6 @@ void Main()
 	AudioAsset::Register(Util::AudioSource::BGM::Title, Audio::Stream, U"audio/recorderwofukuneko.mp3", Loop::Yes);
 	AudioAsset::Register(Util::AudioSource::BGM::Level01, Audio::Stream, U"audio/魔王魂 ループ  サイバー29.mp3");
 	AudioAsset::Register(Util::AudioSource::BGM::Level02, Audio::Stream, U"audio/魔王魂 ループ  サイバー41.mp3");
-	AudioAsset::Register(Util::AudioSource::SE::Open, U"audio/パッ.mp3");
-	AudioAsset::Register(Util::AudioSource::SE::OK, U"audio/決定ボタンを押す39.mp3");
-	AudioAsset::Register(Util::AudioSource::SE::Cancel, U"audio/キャンセル4.mp3");
-	AudioAsset::Register(Util::AudioSource::SE::Announce, U"audio/放送開始チャイム.mp3");
-	AudioAsset::Register(Util::AudioSource::SE::CountDown, U"audio/パパッ.mp3");
-	AudioAsset::Register(Util::AudioSource::SE::StartLevel, U"audio/警官のホイッスル1.mp3");
-	AudioAsset::Register(Util::AudioSource::SE::FinishLevel, U"audio/警官のホイッスル2.mp3");
-	AudioAsset::Register(Util::AudioSource::SE::Correct, U"audio/クイズ正解1.mp3");
-	AudioAsset::Register(Util::AudioSource::SE::Incorrect, U"audio/クイズ不正解1.mp3");
-	AudioAsset::Register(Util::AudioSource::SE::TimeUp, U"audio/試合終了のゴング.mp3");
-	// ループのタイミング指定はサンプリング周波数を掛けて実際のサンプル数にしないといけないらしい by Google 検索の AI
-	AudioAsset::Register(Util::AudioSource::SE::CountUpScore, U"audio/ドラムロール.mp3", Arg::loopBegin = static_cast<uint64>(0.683 * 44100), Arg::loopEnd = static_cast<uint64>(4.272 * 44100));
-	AudioAsset::Register(Util::AudioSource::SE::FinishScore, U"audio/ロールの閉め.mp3");
-	AudioAsset::Register(Util::AudioSource::SE::Cat01, U"audio/猫の鳴き声1.mp3");
-	AudioAsset::Register(Util::AudioSource::SE::Cat02, U"audio/猫の鳴き声2.mp3");
-	AudioAsset::Register(Util::AudioSource::SE::CatAngry, U"audio/猫の威嚇.mp3");
 
 	// ウィンドウの設定
 	Window::SetTitle(U"UFO猫をつかまえろ!!");
@@ -52,21 +34,74 @@ void Main()
 	Scene::SetResizeMode(ResizeMode::Keep);
 
 	App app;
+	app.get()->bootStartTime = bootStartTime;
+
+# if _DEBUG
+	// 開発中は、書き換えたファイルがすぐ反映されるようにばらばらのファイルを読み込む
+	app.get()->assets = Util::AssetPack{};
+# else
+	// パックがあればそれを、なければばらばらのファイルを読み込む
+	app.get()->assets = Util::AssetPack::Open(U"assets.pack").value_or(Util::AssetPack{});
+# endif
 
+	// 効果音は登録だけして、使う直前のシーンで読み込む
+	auto &soundEffects = app.get()->soundEffects;
+	soundEffects.add(Util::AudioSource::SE::Open, U"audio/パッ.mp3");
+	soundEffects.add(Util::AudioSource::SE::OK, U"audio/決定ボタンを押す39.mp3");
+	soundEffects.add(Util::AudioSource::SE::Cancel, U"audio/キャンセル4.mp3");
+	soundEffects.add(Util::AudioSource::SE::Announce, U"audio/放送開始チャイム.mp3");
+	soundEffects.add(Util::AudioSource::SE::CountDown, U"audio/パパッ.mp3");
+	soundEffects.add(Util::AudioSource::SE::StartLevel, U"audio/警官のホイッスル1.mp3");
+	soundEffects.add(Util::AudioSource::SE::FinishLevel, U"audio/警官のホイッスル2.mp3");
+	soundEffects.add(Util::AudioSource::SE::Correct, U"audio/クイズ正解1.mp3");
+	soundEffects.add(Util::AudioSource::SE::Incorrect, U"audio/クイズ不正解1.mp3");
+	soundEffects.add(Util::AudioSource::SE::TimeUp, U"audio/試合終了のゴング.mp3");
+	// ループのタイミング指定はサンプリング周波数を掛けて実際のサンプル数にしないといけないらしい by Google 検索の AI
+	soundEffects.add(Util::AudioSource::SE::CountUpScore, U"audio/ドラムロール.mp3", AudioLoopTiming{ static_cast<uint64>(0.683 * 44100), static_cast<uint64>(4.272 * 44100) });
+	soundEffects.add(Util::AudioSource::SE::FinishScore, U"audio/ロールの閉め.mp3");
+	soundEffects.add(Util::AudioSource::SE::Cat01, U"audio/猫の鳴き声1.mp3");
+	soundEffects.add(Util::AudioSource::SE::Cat02, U"audio/猫の鳴き声2.mp3");
+	soundEffects.add(Util::AudioSource::SE::CatAngry, U"audio/猫の威嚇.mp3");
+
+	app.add<Boot>(State::Boot);
 	app.add<Title>(State::Title);
 	app.add<Wanted>(State::Wanted);
 	app.add<Level>(State::Level);
 	app.add<Result>(State::Result);
 
-	app.init(State::Title, 1s);
+	// 読み込み画面はすぐに出す
+	app.init(State::Boot, 0s);
 	
 	while (System::Update())
 	{
+		// シーンの更新より先に、このフレームのクリックを確定させる
+		app.get()->input.update();
+
+		// level_data.json が書き換えられていたら、フレームの合間にレベルデータを差し替える
+		ApplyLevelDataChanges(*app.get());
+
 		if (not app.update())
 		{
 			break;
 		}
+
+		// シーンが出した音の操作を、まとめて実行する
+		app.get()->audio.flush();
+
+		GUI::LayoutCounter::NextFrame();
+
+# if _DEBUG
+		// GUI は値が変わったときしかレイアウトしなおさないので、ここに出てくるのはシーンの切り替えなどのフレームだけのはず
+		if (const size_t count = GUI::LayoutCounter::LastFrame();
+			count > 0)
+		{
+			Logger << U"[GUI] {} layout(s) at frame {}"_fmt(count, Scene::FrameCount());
+		}
+# endif
 	}
+
+	// 今回使った文字を保存して、次回の起動時にグリフを作っておけるようにする
+	Util::GlyphCache::Save();
 }
 
 //
@@ -9,11 +9,17 @@ namespace UFOCat::GUI
 	{
 		m_region = RectF{ size };
 		m_positionType = positionType;
+		LayoutCounter::Add();
 	}
 
 	ProgressBar &ProgressBar::set(const SizeF &size, ColorF color, PositionType positionType, double roundness)
 	{
-		m_region = RectF{ size };
+		// 位置はそのままで、大きさが変わったときだけ領域を更新する
+		if (m_region.size != size)
+		{
+			m_region.setSize(size);
+			LayoutCounter::Add();
+		}
 		m_color = color;
 		m_positionType = positionType;
 		m_roundness = roundness;
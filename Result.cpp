@@ -16,6 +16,15 @@ namespace UFOCat
 	Result::Result(const InitData &init)
 		: IScene{ init }
 	{
+		// 評価の見出しは TextBox を使っていないので、次回のためにここで文字を記録しておく
+		Util::GlyphCache::Add(m_EvaluationHeading);
+		Util::GlyphCache::Add(m_TitlePrefix);
+		Util::GlyphCache::Add(m_TitleSuffix);
+
+		// GUI の見た目はここで一度だけ決めておき、更新処理では位置だけを変える
+		m_gui.toTitle.set(32, U"タイトルへ");
+		m_gui.scoreTitleGauge.set({ 0.65 * Scene::Width(), 15.0 }, Util::Palette::LightBrown);
+
 		// 現在のプレイの総合得点を計算しておく
 		const uint32 total = getData().scores.back().calculateTotal();
 
@@ -45,7 +54,7 @@ namespace UFOCat
 			if (const size_t total = getData().scores.back().total;
 				m_ScoreCount < total)
 			{
-				AudioAsset(Util::AudioSource::SE::CountUpScore).play();
+				getData().audio.play(Util::AudioSource::SE::CountUpScore);
 
 				// インターバルは 2.0s を目指すが、引き算の結果がデルタタイムより小さくなった場合は、デルタタイムを使用する
 				double interval = Max(2.0 / total - Scene::DeltaTime(), Scene::DeltaTime());
@@ -112,8 +121,8 @@ namespace UFOCat
 			{
 				if (not m_isFinishedCountUp)
 				{
-					AudioAsset(Util::AudioSource::SE::CountUpScore).stop();
-					AudioAsset(Util::AudioSource::SE::FinishScore).play();
+					getData().audio.stop(Util::AudioSource::SE::CountUpScore);
+					getData().audio.play(Util::AudioSource::SE::FinishScore);
 
 					m_isFinishedCountUp = true;
 				}
@@ -123,17 +132,15 @@ namespace UFOCat
 
 		// # GUI 更新処理
 		{
-			m_gui.scoreTitleGauge.set({ 0.65 * Scene::Width(), 15.0 }, Util::Palette::LightBrown)
-				.setPosition(Arg::topCenter = Vec2{ Scene::Center().x, Scene::Center().y + 110 });
-			if (m_gui.toTitle.set(32, U"タイトルへ")
-							  .setPosition(Arg::bottomLeft = Vec2{ 10.0, Scene::Height() - 10.0 })
+			m_gui.scoreTitleGauge.setPosition(Arg::topCenter = Vec2{ Scene::Center().x, Scene::Center().y + 110 });
+			if (m_gui.toTitle.setPosition(Arg::bottomLeft = Vec2{ 10.0, Scene::Height() - 10.0 })
 							  .isPressed())
 			{
 				// まだスコアのカウントアップが途中だったら、シンバルは鳴らしておく
 				if (not m_isFinishedCountUp)
 				{
-					AudioAsset(Util::AudioSource::SE::CountUpScore).stop();
-					AudioAsset(Util::AudioSource::SE::FinishScore).play();
+					getData().audio.stop(Util::AudioSource::SE::CountUpScore);
+					getData().audio.play(Util::AudioSource::SE::FinishScore);
 				}
 
 				// リセット処理は、タイトル側で行う
@@ -206,17 +213,17 @@ namespace UFOCat
 			// 回転座標系
 			{
 				const Transformer2D tr{ Mat3x2::Rotate(-15_deg, maxRegion.left().end) };
-				FontAsset(Util::FontFamily::YuseiMagic)(U"今回の評価").draw(40, Arg::bottomCenter = Vec2{ maxRegion.x, maxRegion.y });
+				FontAsset(Util::FontFamily::YuseiMagic)(m_EvaluationHeading).draw(40, Arg::bottomCenter = Vec2{ maxRegion.x, maxRegion.y });
 			}
 
 			{
 				// RoundRect{ Vec2{ }, SizeF(0.65 * Scene::Width(), 150.0), 12.0};
 
-				const RectF &region1 = FontAsset(Util::FontFamily::YuseiMagic)(U"キミは").draw(26, Arg::bottomLeft = (m_gui.scoreTitleGauge.getRegion().tl() - Point{ 0, 20 }));
+				const RectF &region1 = FontAsset(Util::FontFamily::YuseiMagic)(m_TitlePrefix).draw(26, Arg::bottomLeft = (m_gui.scoreTitleGauge.getRegion().tl() - Point{ 0, 20 }));
 
 				const RectF &region2 = FontAsset(Util::FontFamily::KoharuiroSunray)(U"{}"_fmt(m_currentTitle.kanjiName)).drawBase(60, (region1.br() + Point{ 10, 5 }));
 
-				FontAsset(Util::FontFamily::YuseiMagic)(U"UFO猫ハンターだ！！").draw(26, Arg::bottomLeft = Vec2{ (region2.br().x + 10), region1.br().y });
+				FontAsset(Util::FontFamily::YuseiMagic)(m_TitleSuffix).draw(26, Arg::bottomLeft = Vec2{ (region2.br().x + 10), region1.br().y });
 
 				// 称号ゲージ更新
 				m_gui.scoreTitleGauge.draw();
@@ -231,7 +238,8 @@ namespace UFOCat
 
 	Result::~Result()
 	{
-		// 一旦リソース解放
-		TextureAsset::ReleaseAll();
+		// 一旦リソース解放（予算を超えた分の猫のテクスチャと効果音）
+		getData().catTextures.trim();
+		getData().soundEffects.trim();
 	}
 }
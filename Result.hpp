@@ -20,6 +20,15 @@ namespace UFOCat
 
 		bool m_isFinishedCountUp = false;
 
+		/// @brief 評価の見出し
+		constexpr static StringView m_EvaluationHeading = U"今回の評価";
+
+		/// @brief 称号の前につける文
+		constexpr static StringView m_TitlePrefix = U"キミは";
+
+		/// @brief 称号の後につける文
+		constexpr static StringView m_TitleSuffix = U"UFO猫ハンターだ！！";
+
 		struct
 		{
 			/// @brief タイトルに行くボタン
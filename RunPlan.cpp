@@ -0,0 +1,24 @@
+﻿# include "RunPlan.hpp"
+
+namespace UFOCat::Core
+{
+	RunPlan RunPlan::Create(const Array<LevelData> &levels, const SimilarityMatrix &similarities, uint64 seed, const Size &sceneSize)
+	{
+		// スレッドの乱数生成器は使わず、シード値だけで結果が決まるようにする
+		DefaultRNG rng{ seed };
+
+		RunPlan plan;
+		plan.seed = seed;
+		plan.levels.reserve(levels.size());
+
+		for (size_t i = 0; i < levels.size(); ++i)
+		{
+			// ターゲットはレベルごとに全ての猫からランダムに選ぶ
+			const size_t targetIndex = Random<size_t>(0, similarities.size() - 1, rng);
+
+			plan.levels << LevelPlan::Create(levels[i], i, similarities, targetIndex, sceneSize, rng);
+		}
+
+		return plan;
+	}
+}
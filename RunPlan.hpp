@@ -0,0 +1,26 @@
+﻿# pragma once
+# include "LevelPlan.hpp"
+
+namespace UFOCat::Core
+{
+	/// @brief 1プレイ分の全てのレベルの計画 @n
+	/// タイトルで「あそぶ」が押されたときにワーカースレッドで作り、各シーンは自分のレベルの分を読むだけにする
+	/// @note 同じシード値と同じデータから作れば、全く同じ計画になる
+	struct RunPlan
+	{
+		/// @brief 計画を作るのに使ったシード値
+		uint64 seed = 0;
+
+		/// @brief レベルごとの計画 レベルデータと同じ順に並ぶ
+		Array<LevelPlan> levels;
+
+		/// @brief 全てのレベルの計画を立てる
+		/// @param levels 全てのレベルデータ
+		/// @param similarities 全ての猫同士の類似度の表
+		/// @param seed シード値
+		/// @param sceneSize シーンの大きさ（猫の速度を決めるのに使う）
+		/// @return 計画
+		/// @note シード値で初期化した専用の乱数生成器を使うので、呼び出したスレッドの乱数には影響しない
+		static RunPlan Create(const Array<LevelData> &levels, const SimilarityMatrix &similarities, uint64 seed, const Size &sceneSize);
+	};
+}
@@ -59,15 +59,9 @@ namespace UFOCat::GUI
 		double direction = Abs(target.minY) > Abs(target.maxY) ? -1 : 1;
 
 		// スクロール進捗をターゲットの位置に合わせる
+		// インナー要素の各コンテンツは、描画するときにインナー（下地）の移動分だけずらすので、ここでは動かさない
 		target.region.y = Clamp(direction * m_progress * target.getRange(), target.minY, target.maxY);
 
-		for (const auto &content : m_contents)
-		{
-			// インナー要素すべてをデフォルト位置からインナー（下地）の移動分だけずらす
-			// デフォルト位置：スクロールが0の状態での座標として移動の基準になる
-			content->setPosition(Vec2{ content->getInitialPosition().x, m_inner.region.y + content->getInitialPosition().y });
-		}
-
 		return *this;
 	}
 
@@ -130,6 +124,88 @@ namespace UFOCat::GUI
 				}
 			}
 		}
+
+		m_updateBounds();
+	}
+
+	void Scrollable::m_updateBounds()
+	{
+		m_bounds.clear();
+		m_bounds.reserve(m_contents.size());
+
+		for (size_t i = 0; i < m_contents.size(); ++i)
+		{
+			const RectF &region = m_contents[i]->getRegion();
+			m_bounds << Bound{ region.topY(), region.bottomY(), 0.0, i };
+		}
+
+		// 重なっている要素の描画順が変わらないように、安定ソートする
+		m_bounds.stable_sort_by([](const Bound &a, const Bound &b) { return a.top < b.top; });
+
+		double maxBottom = std::numeric_limits<double>::lowest();
+
+		for (auto &bound : m_bounds)
+		{
+			maxBottom = Max(maxBottom, bound.bottom);
+			bound.maxBottom = maxBottom;
+		}
+
+		m_isDirty = true;
+	}
+
+	void Scrollable::m_render()
+	{
+		m_isDirty = false;
+
+		const Size size{ static_cast<int32>(Ceil(m_region.w)), static_cast<int32>(Ceil(m_inner.region.h)) };
+
+		// 高すぎるインナーはテクスチャにせず、draw() で見えている要素だけを描く
+		if (m_contents.empty() or (size.x <= 0) or (size.y <= 0) or (size.y > m_MaxCanvasHeight))
+		{
+			m_canvas = RenderTexture{};
+			return;
+		}
+
+		if (m_canvas.size() != size)
+		{
+			m_canvas = RenderTexture{ size, ColorF{ 0.0, 0.0 } };
+		}
+		else
+		{
+			m_canvas.clear(ColorF{ 0.0, 0.0 });
+		}
+
+		// 透明なテクスチャに描くと色がアルファ乗算済みになるので、アルファもそれに合わせて重ねる
+		// 描画するときは `BlendState::Premultiplied` で貼る
+		BlendState blend = BlendState::Default2D;
+		blend.srcAlpha = Blend::One;
+		blend.dstAlpha = Blend::InvSrcAlpha;
+		blend.opAlpha = BlendOp::Add;
+
+		const ScopedRenderTarget2D target{ m_canvas };
+		const ScopedRenderStates2D states{ blend };
+
+		m_drawContents(0.0, m_inner.region.h);
+	}
+
+	void Scrollable::m_drawContents(double top, double bottom) const
+	{
+		// 上端が範囲の下端より下にある要素からあとは、描かなくてよい
+		const auto last = std::lower_bound(m_bounds.begin(), m_bounds.end(), bottom,
+			[](const Bound &bound, double y) { return bound.top < y; });
+
+		// 先頭からの下端の最大値が、初めて範囲の上端を越える要素から描き始める
+		const auto first = std::upper_bound(m_bounds.begin(), last, top,
+			[](double y, const Bound &bound) { return y < bound.maxBottom; });
+
+		for (auto itr = first; itr != last; ++itr)
+		{
+			// 前の要素が長いと、間にある短い要素は範囲より上で終わっていることがある
+			if (itr->bottom > top)
+			{
+				m_contents[itr->index]->draw();
+			}
+		}
 	}
 
 	Scrollable &Scrollable::setRegion(const RectF &viewport)
@@ -150,6 +226,12 @@ namespace UFOCat::GUI
 
 	void Scrollable::update()
 	{
+		// コンテンツが変わっていたら、テクスチャに描きなおしておく
+		if (m_isDirty)
+		{
+			m_render();
+		}
+
 		// 以降の処理はスクロールの必要がないなら何もしない
 		if (not m_shouldScroll())
 		{
@@ -190,12 +272,17 @@ namespace UFOCat::GUI
 		{
 			const ScopedViewport2D viewport{ m_region.asRect() };
 
-			if (not m_contents.empty())
+			// テクスチャに描いてあれば、スクロール分ずらして貼るだけ
+			if (m_canvas and (not m_isDirty))
 			{
-				for (const auto& content : m_contents)
-				{
-					content->draw();
-				}
+				const ScopedRenderStates2D premultiplied{ BlendState::Premultiplied };
+				m_canvas.draw(0.0, m_inner.region.y);
+			}
+			// テクスチャがない（インナーが高すぎる、まだ update() されていない）ときは、見えている要素だけを描く
+			else
+			{
+				const Transformer2D scroll{ Mat3x2::Translate(0.0, m_inner.region.y) };
+				m_drawContents(-m_inner.region.y, -m_inner.region.y + m_region.h);
 			}
 			
 			if (m_shouldScroll())
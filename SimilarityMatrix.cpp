@@ -0,0 +1,151 @@
+﻿# include "SimilarityMatrix.hpp"
+
+namespace UFOCat::Core
+{
+	SimilarityMatrix::SimilarityMatrix(const Array<std::shared_ptr<CatData>> &cats)
+		: m_size{ cats.size() }
+		, m_values(cats.size() * cats.size(), 0)
+	{
+		for (const auto &a : cats)
+		{
+			if (a->index >= m_size)
+			{
+				throw Error{ U"Cat index {} is out of range. (count: {})"_fmt(a->index, m_size) };
+			}
+		}
+
+		// 類似度は対称なので、半分だけ計算して両側に入れる
+		for (size_t i = 0; i < cats.size(); ++i)
+		{
+			for (size_t j = i; j < cats.size(); ++j)
+			{
+				const uint8 count = static_cast<uint8>(cats[i]->getSameDataCount(*cats[j]));
+				m_values[cats[i]->index * m_size + cats[j]->index] = count;
+				m_values[cats[j]->index * m_size + cats[i]->index] = count;
+				m_maxScore = Max(m_maxScore, count);
+			}
+		}
+
+		if (m_size < 2)
+		{
+			return;
+		}
+
+		// 猫ごとに、自分以外を類似度で振り分ける（計数ソート）
+		m_orders.resize(m_size * (m_size - 1));
+		m_offsets.resize(m_size * m_stride());
+
+		for (size_t a = 0; a < m_size; ++a)
+		{
+			uint32 *const offsets = &m_offsets[a * m_stride()];
+
+			// まず類似度ごとの数を数えて、
+			for (size_t b = 0; b < m_size; ++b)
+			{
+				if (b != a)
+				{
+					++offsets[(*this)(a, b) + 1];
+				}
+			}
+
+			// 累積して範囲の始まりにする
+			for (size_t s = 1; s < m_stride(); ++s)
+			{
+				offsets[s] += offsets[s - 1];
+			}
+
+			// 始まりの位置から順に詰めていく
+			Array<uint32> cursors(offsets, offsets + m_stride());
+			uint32 *const orders = &m_orders[a * (m_size - 1)];
+
+			for (size_t b = 0; b < m_size; ++b)
+			{
+				if (b != a)
+				{
+					orders[cursors[(*this)(a, b)]++] = static_cast<uint32>(b);
+				}
+			}
+		}
+	}
+
+	size_t SimilarityMatrix::m_stride() const noexcept
+	{
+		// 類似度 0 ~ m_maxScore の始まりと、最後の終わりの分
+		return static_cast<size_t>(m_maxScore) + 2;
+	}
+
+	std::span<const uint32> SimilarityMatrix::m_range(size_t target, size_t first, size_t last) const
+	{
+		if (m_orders.isEmpty())
+		{
+			return {};
+		}
+
+		last = Min(last, static_cast<size_t>(m_maxScore) + 1);
+
+		if (first >= last)
+		{
+			return {};
+		}
+
+		const uint32 *const offsets = &m_offsets[target * m_stride()];
+		const uint32 *const orders = &m_orders[target * (m_size - 1)];
+
+		return { orders + offsets[first], orders + offsets[last] };
+	}
+
+	size_t SimilarityMatrix::size() const noexcept
+	{
+		return m_size;
+	}
+
+	uint8 SimilarityMatrix::maxScore() const noexcept
+	{
+		return m_maxScore;
+	}
+
+	std::span<const uint32> SimilarityMatrix::equalTo(size_t target, size_t score) const
+	{
+		return m_range(target, score, score + 1);
+	}
+
+	std::span<const uint32> SimilarityMatrix::lessThan(size_t target, size_t score) const
+	{
+		return m_range(target, 0, score);
+	}
+
+	Array<size_t> SimilarityMatrix::Sample(std::span<const uint32> pool, size_t count, DefaultRNG &rng, const HashSet<size_t> &excluded)
+	{
+		Array<size_t> result(Arg::reserve = Min(count, pool.size()));
+
+		if (count == 0)
+		{
+			return result;
+		}
+
+		// 候補になった数
+		size_t seen = 0;
+
+		for (const uint32 id : pool)
+		{
+			if (excluded.contains(id))
+			{
+				continue;
+			}
+
+			++seen;
+
+			// はじめの count 個はそのまま入れ、それ以降は count / seen の確率で入れ替える
+			if (result.size() < count)
+			{
+				result << id;
+			}
+			else if (const size_t j = Random<size_t>(0, seen - 1, rng); j < count)
+			{
+				result[j] = id;
+			}
+		}
+
+		return result;
+	}
+}
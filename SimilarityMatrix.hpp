@@ -0,0 +1,88 @@
+﻿# pragma once
+# include <span>
+# include "CatData.hpp"
+
+namespace UFOCat::Core
+{
+	/// @brief 全ての UFO猫同士の類似度（`CatData::getSameDataCount()` の値）を、読み込み時に1度だけ計算して持っておく表 @n
+	/// N 種類の猫に対して N x N の `uint8` を持つ（44 種類なら 2KB 弱） @n
+	/// 猫は全て `CatData::index` で指定する @n
+	/// あわせて、猫ごとに「自分以外の猫を類似度の昇順に並べた ID の列」と「類似度ごとの区切り位置」を持っていて、
+	/// ある類似度の猫たちや、ある類似度未満の猫たちを、全種類を走査せずに連続した範囲として取り出せる
+	class SimilarityMatrix
+	{
+	private:
+		/// @brief 猫の種類の数
+		size_t m_size = 0;
+
+		/// @brief 類似度の最大値
+		uint8 m_maxScore = 0;
+
+		/// @brief `[a * m_size + b]` に ID が a と b の猫の類似度が入る
+		Array<uint8> m_values;
+
+		/// @brief 猫ごとに、自分以外の猫の ID を類似度の昇順に並べたもの @n
+		/// ID が a の猫の分は `[a * (m_size - 1), (a + 1) * (m_size - 1))` に入っている
+		Array<uint32> m_orders;
+
+		/// @brief `m_orders` の中で、類似度ごとの範囲が始まる位置 @n
+		/// ID が a の猫の、類似度 s の範囲は `[m_offsets[a * m_stride() + s], m_offsets[a * m_stride() + s + 1])`
+		Array<uint32> m_offsets;
+
+		/// @brief 猫1匹あたりの `m_offsets` の要素数
+		size_t m_stride() const noexcept;
+
+		/// @brief 類似度の範囲から、猫の ID の列を取り出す
+		/// @param target 基準になる猫の ID
+		/// @param first 範囲に含める最小の類似度
+		/// @param last 範囲に含めない最小の類似度（`m_maxScore + 1` まで）
+		/// @return ID の列
+		std::span<const uint32> m_range(size_t target, size_t first, size_t last) const;
+
+	public:
+		/// @brief デフォルトコンストラクタ 空の表になる
+		SimilarityMatrix() = default;
+
+		/// @brief 全ての猫のデータから表を作る
+		/// @param cats 全ての UFO猫のデータ（`CatData::index` が配列の位置と一致していること）
+		explicit SimilarityMatrix(const Array<std::shared_ptr<CatData>> &cats);
+
+		/// @brief 猫の種類の数を取得する
+		/// @return 種類の数
+		size_t size() const noexcept;
+
+		/// @brief 類似度の最大値を取得する
+		/// @return 類似度の最大値
+		uint8 maxScore() const noexcept;
+
+		/// @brief 2匹の猫の類似度を取得する
+		/// @param a 片方の猫の ID
+		/// @param b もう片方の猫の ID
+		/// @return 一致している特徴の数
+		uint8 operator()(size_t a, size_t b) const noexcept
+		{
+			return m_values[a * m_size + b];
+		}
+
+		/// @brief ある猫と、類似度がちょうど `score` の猫たちを取得する
+		/// @param target 基準になる猫の ID
+		/// @param score 類似度
+		/// @return 猫の ID の列（`target` 自身は含まない）
+		std::span<const uint32> equalTo(size_t target, size_t score) const;
+
+		/// @brief ある猫と、類似度が `score` 未満の猫たちを取得する
+		/// @param target 基準になる猫の ID
+		/// @param score 類似度
+		/// @return 猫の ID の列 類似度の昇順に並んでいる
+		std::span<const uint32> lessThan(size_t target, size_t score) const;
+
+		/// @brief ID の列から、重複なしでランダムに選ぶ（リザーバサンプリング） @n
+		/// 列を1度なめるだけで、並べ替えやシャッフルはしない
+		/// @param pool 選ぶ元の ID の列
+		/// @param count 選ぶ数 足りなければ選べる分だけ選ぶ
+		/// @param rng 使う乱数生成器
+		/// @param excluded 選ばない ID
+		/// @return 選んだ ID
+		static Array<size_t> Sample(std::span<const uint32> pool, size_t count, DefaultRNG &rng, const HashSet<size_t> &excluded = {});
+	};
+}
@@ -0,0 +1,184 @@
+﻿# include "SoundEffectCache.hpp"
+# include "Hash.hpp"
+
+namespace UFOCat::Util
+{
+	SoundEffectCache::SoundEffectCache(size_t budget)
+		: m_budget{ budget }
+	{}
+
+	void SoundEffectCache::m_touch(AssetNameView name)
+	{
+		// 最近使われたものとして一番後ろに移す
+		m_resident.remove(AssetName{ name });
+		m_resident << AssetName{ name };
+	}
+
+	void SoundEffectCache::m_sync()
+	{
+		for (const auto &[name, path] : m_paths)
+		{
+			if (AudioAsset::IsReady(name) and (not m_resident.contains(name)))
+			{
+				m_resident << name;
+			}
+		}
+	}
+
+	size_t SoundEffectCache::m_bytes(AssetNameView name)
+	{
+		// デコードした波形は、1サンプルにつき左右の float を持っている
+		return AudioAsset::IsReady(name) ? static_cast<size_t>(AudioAsset(name).samples()) * sizeof(WaveSample) : 0;
+	}
+
+	FilePath SoundEffectCache::m_cachePath(FilePathView path)
+	{
+		const std::string key = Format(path, U'|', FileSystem::FileSize(path), U'|', FileSystem::WriteTime(path).map([](const DateTime &time) { return time.format(); }).value_or(U"")).toUTF8();
+
+		return U"{}/{:016X}.wav"_fmt(CacheDirectory, Fnv1a(key.data(), key.size()));
+	}
+
+	Wave SoundEffectCache::m_decode(FilePathView path)
+	{
+		const FilePath cachePath = m_cachePath(path);
+
+		if (FileSystem::IsFile(cachePath))
+		{
+			if (Wave wave{ cachePath })
+			{
+				return wave;
+			}
+		}
+
+		Wave wave{ path };
+
+		// 次回からはデコード済みのものを読み込む 書き込めなくても、今回の再生には影響しない
+		// 書きかけのファイルを読み込まないように、書き込み先ごとに別の一時ファイルに書き切ってから置き換える
+		// 同じ効果音を複数のスレッドが同時に書いても、どれも完全なファイルなので、最後に置き換えたものが残るだけ
+		if (wave)
+		{
+			FileSystem::CreateDirectories(CacheDirectory);
+			const FilePath tempPath = U"{}.{:016X}.tmp"_fmt(cachePath, RandomUint64());
+
+			if (wave.saveWAVE(tempPath) and FileSystem::Rename(tempPath, cachePath))
+			{
+# if _DEBUG
+				Logger << U"[SoundEffectCache] Decoded `{}` -> `{}`"_fmt(path, cachePath);
+# endif
+			}
+			else
+			{
+				FileSystem::Remove(tempPath);
+			}
+		}
+
+		return wave;
+	}
+
+	void SoundEffectCache::add(AssetNameView name, FilePathView path, const Optional<AudioLoopTiming> &loop)
+	{
+		m_paths[AssetName{ name }] = path;
+
+		auto data = std::make_unique<AudioAssetData>();
+		data->path = path;
+		data->loopTiming = loop;
+
+		// 読み込むときに、ファイルを直接デコードする代わりにデコード済みの WAV ファイルを使う
+		data->onLoad = [](AudioAssetData &asset, [[maybe_unused]] const String &hint)
+		{
+			Wave wave = m_decode(asset.path);
+
+			if (not wave)
+			{
+				return false;
+			}
+
+			asset.audio = asset.loopTiming
+				? Audio{ std::move(wave), Arg::loopBegin = asset.loopTiming->beginPos, Arg::loopEnd = asset.loopTiming->endPos }
+				: Audio{ std::move(wave) };
+
+			return static_cast<bool>(asset.audio);
+		};
+
+		AudioAsset::Register(name, std::move(data));
+	}
+
+	Wave SoundEffectCache::decode(AssetNameView name) const
+	{
+		const auto it = m_paths.find(AssetName{ name });
+
+		if (it == m_paths.end())
+		{
+			throw Error{ U"Sound effect `{}` is not added."_fmt(name) };
+		}
+
+		return m_decode(it->second);
+	}
+
+	void SoundEffectCache::preload(const Array<AssetName> &names)
+	{
+		for (const auto &name : names)
+		{
+			if (not m_paths.contains(name))
+			{
+				throw Error{ U"Sound effect `{}` is not added."_fmt(name) };
+			}
+
+			if (m_resident.contains(name) or AudioAsset::IsReady(name))
+			{
+				++m_stats.hits;
+			}
+			else
+			{
+				++m_stats.misses;
+				AudioAsset::LoadAsync(name);
+			}
+
+			m_touch(name);
+		}
+	}
+
+	void SoundEffectCache::setBudget(size_t budget)
+	{
+		m_budget = budget;
+		trim();
+	}
+
+	void SoundEffectCache::trim()
+	{
+		m_sync();
+
+		size_t bytes = residentBytes();
+
+		// 前のほうほど最近使われていない
+		for (auto it = m_resident.begin(); (bytes > m_budget) and (it != m_resident.end());)
+		{
+			// 読み込み中のものは解放すると読み込みを待たされ、再生中のものは音が途切れてしまうので残す
+			if ((not AudioAsset::IsReady(*it)) or AudioAsset(*it).isPlaying())
+			{
+				++it;
+				continue;
+			}
+
+			bytes -= m_bytes(*it);
+			AudioAsset::Release(*it);
+			++m_stats.evictions;
+			it = m_resident.erase(it);
+		}
+
+# if _DEBUG
+		Logger << U"[SoundEffectCache] {} effects, {:.1f}MiB resident (hits {}, misses {}, evictions {})"_fmt(
+			m_resident.size(), bytes / (1024.0 * 1024.0), m_stats.hits, m_stats.misses, m_stats.evictions);
+# endif
+	}
+
+	size_t SoundEffectCache::residentBytes() const
+	{
+		return m_resident.map([](const AssetName &name) { return m_bytes(name); }).sum();
+	}
+
+	const SoundEffectCache::Stats &SoundEffectCache::stats() const noexcept
+	{
+		return m_stats;
+	}
+}
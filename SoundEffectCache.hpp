@@ -0,0 +1,109 @@
+﻿# pragma once
+
+namespace UFOCat::Util
+{
+	/// @brief 効果音を、必要になったときに初めてデコードし、デコードしたままにしておく効果音の合計サイズを予算以下に抑える管理クラス @n
+	/// 効果音は `AudioAsset` として登録するだけで、最初に `AudioAsset()` で使われるか `preload()` されたときに読み込まれる @n
+	/// MP3 をデコードした結果は WAV としてディスクに保存しておき、次回からは MP3 のデコードを省く
+	/// @note 予算を超えたら、再生中のもの以外を、最近使われていない順に解放する
+	class SoundEffectCache
+	{
+	public:
+		/// @brief キャッシュの効き具合の記録
+		struct Stats
+		{
+			/// @brief `preload()` で要求されたときに、すでに読み込み済み（または読み込み中）だった回数
+			size_t hits = 0;
+
+			/// @brief `preload()` で要求されたときに、読み込まれていなかった回数
+			size_t misses = 0;
+
+			/// @brief 予算を超えたために解放した回数
+			size_t evictions = 0;
+		};
+
+	private:
+		/// @brief デコードしたままにしておく効果音の合計サイズの予算 [bytes]
+		size_t m_budget;
+
+		/// @brief 登録した効果音のアセット名と音声ファイルのパスの対応
+		HashTable<AssetName, FilePath> m_paths;
+
+		/// @brief 読み込み中、または読み込み済みの効果音のアセット名 最近使われたものほど後ろに並ぶ
+		Array<AssetName> m_resident;
+
+		/// @brief キャッシュの効き具合の記録
+		Stats m_stats;
+
+		/// @brief 最近使われたものとして記録する
+		/// @param name アセット名
+		void m_touch(AssetNameView name);
+
+		/// @brief `preload()` を通さずに `AudioAsset()` で読み込まれた効果音も、使われたものとして記録する
+		void m_sync();
+
+		/// @brief デコードした効果音の、メモリ上でのサイズを求める
+		/// @param name アセット名
+		/// @return サイズ [bytes] まだ読み込み中なら 0
+		static size_t m_bytes(AssetNameView name);
+
+		/// @brief 音声ファイルに対応する、デコード済みの WAV ファイルのパスを取得する @n
+		/// 音声ファイルのパス、サイズ、更新日時から名前を作るので、元のファイルが書き換えられたら別のパスになる
+		/// @param path 音声ファイルのパス
+		/// @return WAV ファイルのパス
+		static FilePath m_cachePath(FilePathView path);
+
+		/// @brief 音声ファイルをデコードする デコード済みの WAV ファイルがあればそれを読み込み、なければ作る @n
+		/// WAV ファイルは一時ファイルに書き切ってから名前を変えるので、途中で終了しても書きかけのものは残らない
+		/// @param path 音声ファイルのパス
+		/// @return 波形
+		/// @note アセットの非同期読み込みでワーカースレッドから呼ばれるので、メンバには触らない
+		static Wave m_decode(FilePathView path);
+
+	public:
+		/// @brief 予算の既定値（44.1kHz ステレオで 50秒 分くらい）
+		constexpr static size_t DefaultBudget = 16 * 1024 * 1024;
+
+		/// @brief デコード済みの WAV ファイルを置くフォルダ
+		constexpr static StringView CacheDirectory = U"cache/audio";
+
+		/// @brief 予算を指定して初期化する
+		/// @param budget デコードしたままにしておく効果音の合計サイズの予算 [bytes]
+		explicit SoundEffectCache(size_t budget = DefaultBudget);
+
+		/// @brief 効果音をアセット登録する この時点ではデコードしない
+		/// @param name アセット名
+		/// @param path 音声ファイルのパス
+		/// @param loop ループさせる範囲 [samples]
+		void add(AssetNameView name, FilePathView path, const Optional<AudioLoopTiming> &loop = none);
+
+		/// @brief 効果音をアセットとは別にデコードする @n
+		/// 同じ効果音を重ねて鳴らすために、別々の `Audio` を作りたいときに使う
+		/// @param name アセット名
+		/// @return 波形
+		/// @remarks 登録されていない効果音なら例外が投げられる
+		/// @note 登録済みのパスを読むだけなので、`add()` を呼び終えたあとならワーカースレッドから呼び出してもよい
+		Wave decode(AssetNameView name) const;
+
+		/// @brief 次のシーンなどで使う効果音の非同期読み込みを始め、最近使われたものとして記録する
+		/// @param names アセット名のリスト
+		void preload(const Array<AssetName> &names);
+
+		/// @brief 予算を変更する 超えていれば、その場で解放する
+		/// @param budget 予算 [bytes]
+		void setBudget(size_t budget);
+
+		/// @brief 予算を超えている分の効果音を、再生中でないものから最近使われていない順に解放する @n
+		/// シーンの終わりなど、使い終わった効果音が残っていてもよいタイミングで呼び出す
+		/// @note アセット登録は残すので、解放した効果音も `AudioAsset()` や `preload()` でまた読み込める
+		void trim();
+
+		/// @brief 読み込み済みの効果音の合計サイズを取得する
+		/// @return 合計サイズ [bytes]
+		size_t residentBytes() const;
+
+		/// @brief キャッシュの効き具合の記録を取得する
+		/// @return 記録
+		const Stats &stats() const noexcept;
+	};
+}
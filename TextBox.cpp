@@ -1,4 +1,5 @@
 ﻿# include "GUI.hpp"
+# include "GlyphCache.hpp"
 
 namespace UFOCat::GUI
 {
@@ -9,19 +10,67 @@ namespace UFOCat::GUI
 	{
 		m_region = text.region(fontSize);
 		m_positionType = positionType;
+		m_layout(Math::Inf);
+
+		// 次回の起動時には、読み込み画面の間にグリフを作っておく
+		Util::GlyphCache::Add(text.text);
 	}
 
 	TextBox &TextBox::set(const DrawableText &text, double fontSize, const Color &color, PositionType positionType)
 	{
-		m_region = text.region(fontSize);
-		m_text = text;
-		m_fontSize = fontSize;
 		m_color = color;
 		m_positionType = positionType;
 
+		// テキストと大きさが同じなら、計測しなおさない
+		if ((m_text.text != text.text) or (m_text.font.id() != text.font.id()) or (m_fontSize != fontSize))
+		{
+			m_region = text.region(fontSize);
+			m_text = text;
+			m_fontSize = fontSize;
+			m_layout(Math::Inf);
+
+			Util::GlyphCache::Add(text.text);
+		}
+
 		return *this;
 	}
 
+	void TextBox::m_layout(double width)
+	{
+		Array<String> lines = { String{} };
+		m_layoutWidth = width;
+
+		// グリフの送り幅はフォント本来のサイズのものなので、描画サイズに合わせる
+		const double scale = m_fontSize / m_text.font.fontSize();
+		double penX = 0.0;
+
+		for (const auto &glyph : m_text.font.getGlyphs(m_text.text))
+		{
+			if (glyph.codePoint == U'\n')
+			{
+				lines << String{};
+				penX = 0.0;
+				continue;
+			}
+
+			const double advance = glyph.xAdvance * scale;
+
+			// 1文字も入っていない行は、はみ出してもその文字を置く（でないと永遠に折り返す）
+			if ((width < penX + advance) and (not lines.back().isEmpty()))
+			{
+				lines << String{};
+				penX = 0.0;
+			}
+
+			lines.back().push_back(glyph.codePoint);
+			penX += advance;
+		}
+
+		m_lines = lines.map([this](const String &line) { return m_text.font(line); });
+
+		LayoutCounter::Add();
+	}
+
 	TextBox &TextBox::setIndent(double px)
 	{
 		m_region.setPos(px, m_region.y);
@@ -30,38 +79,33 @@ namespace UFOCat::GUI
 
 	bool TextBox::adjustWidth(double width)
 	{
-		// カウンタをセット
-		double i = 0;
+		const double innerWidth = width - m_region.pos.x;
 
-		// テキストが全て収まりきるまで高さを増やしていく
-		// 初めから収まりきっている場合は、このループに入らない
-		while (not m_text.fits(m_fontSize, RectF{ m_region.pos, width - m_region.pos.x, m_region.h + i }))
+		if (m_layoutWidth != innerWidth)
 		{
-			++i;
+			m_layout(innerWidth);
 		}
 
-		// 収まったら、一旦適用
-		m_region.setSize(width - m_region.pos.x, m_region.h + i);
+		// 高さは行数から直接決まる
+		const SizeF size{ innerWidth, m_lines.size() * m_text.font.height(m_fontSize) };
 
-		// 再度リセット
-		i = 0;
-
-		// 今度はテキストがギリギリ収まりきらなくなるまで高さを減らしていく
-		while (m_text.fits(m_fontSize, RectF{ m_region.pos, width - m_region.pos.x, m_region.h + i }))
+		if (m_region.size == size)
 		{
-			--i;
+			return false;
 		}
 
-		// カウンタを1つ増やしなおして収まる範囲に補正
-		m_region.setSize(width - m_region.pos.x, m_region.h + (++i));
-
-		// i の変更なしでここまで到達していたら、新たな変更がなかったということなので
-		// その判定を戻り値にする
-		return i == 0;
+		m_region.setSize(size);
+		return true;
 	}
 
 	void TextBox::draw() const
 	{
-		m_text.draw(m_fontSize, m_region, m_color);
+		// 折り返しは計算済みなので、1行ずつそのまま描く
+		const double lineHeight = m_text.font.height(m_fontSize);
+
+		for (size_t i = 0; i < m_lines.size(); ++i)
+		{
+			m_lines[i].draw(m_fontSize, m_region.pos.movedBy(0, i * lineHeight), m_color);
+		}
 	}
 }
@@ -0,0 +1,114 @@
+﻿# include "TextMeasure.hpp"
+# include "Hash.hpp"
+
+namespace UFOCat::Util
+{
+	TextMeasure::State &TextMeasure::m_state()
+	{
+		static State state;
+		return state;
+	}
+
+	bool TextMeasure::Key::matches(const Font &font, StringView text, const std::array<double, 4> &values) const noexcept
+	{
+		return (this->font == font.id().value()) and (this->values == values) and (StringView{ this->text } == text);
+	}
+
+	uint64 TextMeasure::m_hash(const Font &font, StringView text, const std::array<double, 4> &values) noexcept
+	{
+		// テキストは先にハッシュ値にしておき、固定長のデータとしてまとめてハッシュ値をとる
+		const struct
+		{
+			uint64 font;
+			uint64 text;
+			std::array<double, 4> values;
+		}
+		key{ font.id().value(), Fnv1a(text.data(), text.size_bytes()), values };
+
+		return Fnv1a(&key, sizeof(key));
+	}
+
+	SizeF TextMeasure::Region(const Font &font, StringView text, double fontSize)
+	{
+		auto &state = m_state();
+		const std::array<double, 4> values{ fontSize, 0.0, 0.0, 0.0 };
+		const uint64 hash = m_hash(font, text, values);
+
+		// ハッシュ値が同じでも、キーが違えば計測しなおして上書きする
+		if (const auto it = state.regions.find(hash);
+			(it != state.regions.end()) and it->second.first.matches(font, text, values))
+		{
+			++state.stats.hits;
+			return it->second.second;
+		}
+
+		++state.stats.misses;
+
+		if (state.regions.size() >= m_MaxEntries)
+		{
+			state.regions.clear();
+		}
+
+		const SizeF size = font(text).region(fontSize).size;
+		state.regions[hash] = { Key{ font.id().value(), String{ text }, values }, size };
+		return size;
+	}
+
+	double TextMeasure::FitSize(const Font &font, StringView text, const SizeF &box, double maxSize, double minSize)
+	{
+		auto &state = m_state();
+		const std::array<double, 4> values{ box.x, box.y, maxSize, minSize };
+		const uint64 hash = m_hash(font, text, values);
+
+		if (const auto it = state.fitSizes.find(hash);
+			(it != state.fitSizes.end()) and it->second.first.matches(font, text, values))
+		{
+			++state.stats.hits;
+			return it->second.second;
+		}
+
+		++state.stats.misses;
+
+		if (state.fitSizes.size() >= m_MaxEntries)
+		{
+			state.fitSizes.clear();
+		}
+
+		const DrawableText drawable = font(text);
+		const RectF area{ box };
+
+		// maxSize - step のサイズで収まる最小の step を探す
+		// 小さいサイズほど収まりやすいので、収まるかどうかは step について単調になる
+		size_t low = 0;
+		size_t high = static_cast<size_t>(Max(0.0, Floor(maxSize - minSize)));
+
+		while (low < high)
+		{
+			const size_t middle = (low + high) / 2;
+
+			if (drawable.fits(maxSize - middle, area))
+			{
+				high = middle;
+			}
+			else
+			{
+				low = middle + 1;
+			}
+		}
+
+		const double size = Max(maxSize - low, minSize);
+		state.fitSizes[hash] = { Key{ font.id().value(), String{ text }, values }, size };
+		return size;
+	}
+
+	void TextMeasure::Clear()
+	{
+		m_state().regions.clear();
+		m_state().fitSizes.clear();
+	}
+
+	const TextMeasure::Stats &TextMeasure::GetStats() noexcept
+	{
+		return m_state().stats;
+	}
+}
@@ -0,0 +1,93 @@
+﻿# pragma once
+
+namespace UFOCat::Util
+{
+	/// @brief テキストの大きさの計測と、矩形に収まるフォントサイズの探索を行い、その結果を覚えておくクラス @n
+	/// 同じフォント・テキスト・大きさで何度呼び出しても、計測するのは初めの 1回 だけになる
+	/// @note フォントアセットと同じくゲーム全体で1つなので、静的メンバだけを持つ
+	class TextMeasure
+	{
+	public:
+		/// @brief 計測の統計情報
+		struct Stats
+		{
+			/// @brief 覚えていた結果を返した回数
+			size_t hits = 0;
+
+			/// @brief 計測しなおした回数
+			size_t misses = 0;
+		};
+
+	private:
+		/// @brief 結果を覚えておくときのキー ハッシュ値が衝突しても取り違えないように、元の値を全て持つ
+		struct Key
+		{
+			/// @brief フォントの ID
+			uint64 font = 0;
+
+			/// @brief テキスト
+			String text;
+
+			/// @brief フォントサイズや矩形の大きさなど、キーに含める数値
+			std::array<double, 4> values{};
+
+			/// @brief フォント・テキストと数値の組が、このキーと同じかどうか
+			/// @param font フォント
+			/// @param text テキスト
+			/// @param values キーに含める数値
+			/// @return 同じなら `true`
+			bool matches(const Font &font, StringView text, const std::array<double, 4> &values) const noexcept;
+		};
+
+		/// @brief 覚えておいた結果
+		struct State
+		{
+			/// @brief テキストの描画領域の大きさ キーのハッシュ値で引く
+			HashTable<uint64, std::pair<Key, SizeF>> regions;
+
+			/// @brief 矩形に収まるフォントサイズ キーのハッシュ値で引く
+			HashTable<uint64, std::pair<Key, double>> fitSizes;
+
+			Stats stats;
+		};
+
+		/// @brief 覚えておく結果の上限 越えたら一旦すべて忘れる
+		constexpr static size_t m_MaxEntries = 1024;
+
+		/// @brief 状態を取得する
+		/// @return 状態
+		static State &m_state();
+
+		/// @brief フォント・テキストと数値の組から、キーのハッシュ値を求める
+		/// @param font フォント
+		/// @param text テキスト
+		/// @param values キーに含める数値
+		/// @return ハッシュ値
+		static uint64 m_hash(const Font &font, StringView text, const std::array<double, 4> &values) noexcept;
+
+	public:
+		/// @brief テキストを 1行 で描画したときの大きさを取得する (`Font(text).region(fontSize).size` と同じ)
+		/// @param font フォント
+		/// @param text テキスト
+		/// @param fontSize フォントサイズ
+		/// @return 描画領域の大きさ
+		static SizeF Region(const Font &font, StringView text, double fontSize);
+
+		/// @brief 矩形の中にテキストが全て収まる、最大のフォントサイズを二分探索で求める @n
+		/// `maxSize` から 1 ずつ小さくしていったときに、初めて収まるサイズと同じものを返す
+		/// @param font フォント
+		/// @param text テキスト
+		/// @param box 収めたい矩形の大きさ
+		/// @param maxSize フォントサイズの上限
+		/// @param minSize フォントサイズの下限 これでも収まらなければこの値を返す (デフォルト: 1.0)
+		/// @return フォントサイズ
+		static double FitSize(const Font &font, StringView text, const SizeF &box, double maxSize, double minSize = 1.0);
+
+		/// @brief 覚えておいた結果をすべて忘れる
+		static void Clear();
+
+		/// @brief 統計情報を取得する
+		/// @return 統計情報
+		static const Stats &GetStats() noexcept;
+	};
+}
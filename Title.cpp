@@ -5,27 +5,16 @@ namespace UFOCat
 	Title::Title(const InitData& init)
 		: IScene{ init }
 	{
-		// 初回起動時
-		if (getData().cats.isEmpty() or getData().levels.isEmpty() or getData().backgrounds.isEmpty())
-		{
-			// データがまだ読み込まれていなければ読み込む
-			getData().cats = LoadCatData().map([](const auto &data) { return std::make_shared<CatData>(data); });
-			getData().levels = LoadLevelData();
-			getData().backgrounds = LoadBackgrounds();
+		// データは Boot シーンで読み込み済み
+		// タイトルに戻ってきた場合のために、読み込んでいるレベルデータのクリアフラグをリセット
+		getData().levels.each([](LevelData &level) { level.isCleared = false; });
 
-			// 最大レベル数の情報をスコアデータに共通のものとして設定しておく
-			Score::Generic::ByLevel::SetLevelCount(getData().levels.size());
-		}
-		// それ以降でタイトルに戻ってきた場合
-		else
-		{
-			// 読み込んでいるレベルデータのクリアフラグをリセット
-			getData().levels.each([](LevelData &level) { level.isCleared = false; });
-		}
+		// 次の Wanted シーンで使う効果音を読み込んでおく
+		getData().soundEffects.preload({ Util::AudioSource::SE::Announce });
 
 		// # GUI 要素設定
 		{
-			m_gui.toLevel.set(36, U"あそぶ", AudioAsset(Util::AudioSource::SE::OK), GUI::PositionType::Absolute, true, { 96, 10 })
+			m_gui.toLevel.set(36, U"あそぶ", Util::AudioSource::SE::OK, GUI::PositionType::Absolute, true, { 96, 10 })
 						 .setPositionAt(Scene::Center() + Vec2{ 0, 60 });
 
 			m_gui.howToPlayButton.set(36, U"あそび方", GUI::PositionType::Absolute, true, { 60, 10 })
@@ -180,7 +169,7 @@ namespace UFOCat
 				}.setMargin({ 0, 0 }).setIndent(40)
 			).setSize({ 600, 500 });
 
-			m_gui.logo = Texture{ U"texture/logo.png", TextureDesc::Mipped };
+			m_gui.logo = getData().assets.loadTexture(U"texture/logo.png", TextureDesc::Mipped);
 		}
 
 		// # タイトル画面に現れる猫を決める
@@ -207,11 +196,20 @@ namespace UFOCat
 			demoActions.shuffle().resize(count);
 
 			// UFO猫のデータからランダムにスポーン数だけチョイスし、
-			getData().spawns = std::move(getData().cats.choice(count)
+			const auto &demoCats = getData().cats.choice(count);
+
+			// タイトルの間は表示し続けるので、テクスチャを使用中にしておく
+			for (const auto &cat : demoCats)
+			{
+				getData().catTextures.pin(cat->textureId);
+				m_pinnedTextureIds << cat->textureId;
+			}
+
+			getData().spawns = std::move(demoCats
 														// 生成して unique_ptr にする
-													   .map([](const auto &cat)
+													   .map([this](const auto &cat)
 													   {
-													       return std::make_unique<CatObject>(CatObject{ TextureAsset(Cat(cat->id)) });
+													       return std::make_unique<CatObject>(CatObject{ getData().catTextures.get(cat->textureId) }.setRecolor(getData().catTextures.getRecolor(*cat)));
 													   })
 														// 作ったポインタのリストに対して
 														// （このリストと `demoActions` の長さはどちらも `count` なので）
@@ -224,18 +222,25 @@ namespace UFOCat
 		}
 
 		// 背景を決める		
-		m_bg = getData().backgrounds.choice();
+		m_bg = getData().backgrounds.choice().loaded(getData().assets);
 
 		// もし他のBGMが流れていた場合も考えて、一度ストップ
-		AudioAsset(getData().bgmName).stop();
+		getData().audio.stop(getData().bgmName);
 
 		getData().bgmName = Util::AudioSource::BGM::Title;
 
-		AudioAsset(getData().bgmName).play();
+		getData().audio.play(getData().bgmName);
 	}
 
 	void Title::update()
 	{
+		// 起動してから初めて操作できるようになるまでの時間
+		if (getData().bootStartTime != 0)
+		{
+			Logger << U"[Boot] Time to first interactive frame: {:.1f}ms"_fmt((Time::GetMicrosec() - getData().bootStartTime) / 1000.0);
+			getData().bootStartTime = 0;
+		}
+
 		// # 猫 更新処理
 		{
 			for (const auto &spawn : getData().spawns)
@@ -254,7 +259,19 @@ namespace UFOCat
 					// スコアデータはレベル数に合わせて確保してから、1プレイ分として追加しておく
 					getData().scores << Score::Generic{ Array<Score::Generic::ByLevel>{ getData().levels.size() }, Score::Generic::Title{} };
 
-					AudioAsset(Util::AudioSource::BGM::Title).fadeVolume(0.0, 0.2s);
+					// 1プレイ分の全てのレベルの計画を、画面が切り替わる間にワーカースレッドで立てる
+					// シード値さえ分かれば、同じプレイを再現できる
+					const uint64 seed = RandomUint64();
+					getData().runPlan.reset();
+					getData().runPlanTask = Async([levels = getData().levels, similarities = getData().similarities, seed, sceneSize = Scene::Size()]()
+					{
+						return RunPlan::Create(levels, similarities, seed, sceneSize);
+					});
+# if _DEBUG
+					Logger << U"[RunPlan] seed: {}"_fmt(seed);
+# endif
+
+					getData().audio.fadeVolume(Util::AudioSource::BGM::Title, 0.0, 0.2s);
 					changeScene(State::Wanted, 1.2s);
 				}
 
@@ -272,6 +289,27 @@ namespace UFOCat
 			m_gui.howToPlay.isPressedOK();
 			m_gui.lisence.isPressedOK();
 		}
+
+# if _DEBUG
+		// デバッグ機能：Ctrl + Shift + B でレベルデータの読み込み時間とパーサーの速度を計測
+		if (KeyControl.pressed() and KeyShift.pressed() and KeyB.down())
+		{
+			Debug::BenchmarkLevelData();
+			Debug::BenchmarkActionParser();
+		}
+
+		// デバッグ機能：Ctrl + Shift + P で `texture` フォルダからアセットパックを作る
+		if (KeyControl.pressed() and KeyShift.pressed() and KeyP.down())
+		{
+			Debug::BuildAssetPack();
+		}
+
+		// デバッグ機能：Ctrl + Shift + M で猫の鳴き声のミキサーに 1000匹 分の負荷をかける
+		if (KeyControl.pressed() and KeyShift.pressed() and KeyM.down())
+		{
+			Debug::StressCatVoices(getData().soundEffects);
+		}
+# endif
 	}
 
 	void Title::draw() const
@@ -302,6 +340,11 @@ namespace UFOCat
 
 	Title::~Title()
 	{
-		AudioAsset(Util::AudioSource::BGM::Title).stop();
+		getData().audio.stop(Util::AudioSource::BGM::Title);
+
+		for (const size_t id : m_pinnedTextureIds)
+		{
+			getData().catTextures.unpin(id);
+		}
 	}
 }
@@ -1,5 +1,6 @@
 ﻿# pragma once
 # include "Common.hpp"
+# include "Debug.hpp"
 
 namespace UFOCat
 {
@@ -30,6 +31,9 @@ namespace UFOCat
 		/// @brief 背景データ
 		Util::BackgroundData m_bg;
 
+		/// @brief デモで表示している猫の、使用中にしたテクスチャの ID
+		Array<size_t> m_pinnedTextureIds;
+
 	public:
 		Title(const InitData &init);
 
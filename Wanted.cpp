@@ -1,4 +1,5 @@
 ﻿# include "Wanted.hpp"
+# include "TextMeasure.hpp"
 
 namespace UFOCat
 {
@@ -20,28 +21,88 @@ namespace UFOCat
 	Wanted::Wanted(const InitData& init)
 		: IScene{ init }
 	{
-		// ターゲットを選ぶ
-		getData().targetId = getData().cats.choice()->id;
-		m_target = getData().cats[getData().targetId];
+		// タイトルで立て始めた1プレイ分の計画を受け取る（普通は画面が切り替わる間に終わっている）
+		if (getData().runPlanTask.isValid())
+		{
+			getData().runPlan = getData().runPlanTask.get();
+		}
+
+		// レベルデータが差し替えられて計画が消えていたら、ここで立て直す
+		if ((not getData().runPlan) or (getData().runPlan->levels.size() != getData().levels.size()))
+		{
+			getData().runPlan = RunPlan::Create(getData().levels, getData().similarities, RandomUint64(), Scene::Size());
+		}
 
 		// 現在行っているレベルのインデックスは、クリアしているレベルの数と同じなのを利用する
 		// （そのレベルが終わり次第、isCleared のフラグを上げるため）
 		getData().levelIndex = getData().levels.filter([](const LevelData &level) { return level.isCleared; }).size();
 
+		// このレベルの計画からターゲットを決め、ターゲットを発表している間に使う猫のテクスチャを読み込んでおく
+		getData().levelPlan = getData().runPlan->levels[getData().levelIndex];
+		getData().targetIndex = getData().levelPlan->targetIndex;
+		m_target = getData().cats[getData().targetIndex];
+		m_targetRecolor = getData().catTextures.getRecolor(*m_target);
+
+		for (const size_t index : getData().levelPlan->selectionIndices)
+		{
+			getData().catTextures.prefetch(getData().cats[index]->textureId);
+		}
+
+		getData().catTextures.prefetch(m_target->textureId);
+
+		// レベル中に使う効果音も、ターゲットを発表している間に読み込んでおく
+		getData().soundEffects.preload
+		({
+			Util::AudioSource::SE::CountDown,
+			Util::AudioSource::SE::StartLevel,
+			Util::AudioSource::SE::FinishLevel,
+			Util::AudioSource::SE::Correct,
+			Util::AudioSource::SE::Incorrect,
+			Util::AudioSource::SE::TimeUp
+		});
+
 		// TODO: レベルが進むごとにちょっと時間を短くしたら面白いかも
 		// ターゲット情報の表示時間
 		getData().timer.set(5s);
 
 		// # GUI 初期化
 		{
+			// 手配書の見出しは TextBox を使っていないので、次回のためにここで文字を記録しておく
+			Util::GlyphCache::Add(m_Heading);
+
+			for (const auto &label : m_InfoLabels)
+			{
+				Util::GlyphCache::Add(label);
+			}
+
 			m_gui.levelBar.set(SizeF{ 0.85 * 180, 10 }, Util::Palette::Brown)
 						  .setPosition(Arg::bottomCenter = Vec2{ 180.0 / 2 + 5, 100 - 5 - 10 })
 						  .setProgress((getData().levelIndex + 1) / 10.0);
 
-			m_gui.flyer = Texture{ U"texture/flyer.png", TextureDesc::Mipped };
+			m_gui.flyer = getData().assets.loadTexture(U"texture/flyer.png", TextureDesc::Mipped);
+
+			// 猫種名を表示するエリアの大きさは draw() と同じように求める（チラシの 30% x 40% のタイトルの横、マージン 20 ずつ）
+			const RectF flyerRegion = m_gui.flyer.resized(Scene::Height() - 150).regionAt(Scene::Center());
+			const SizeF textBox{ 0.3 * flyerRegion.x, 0.4 * flyerRegion.y };
+			m_breedFontSize = Util::TextMeasure::FitSize(FontAsset(Util::FontFamily::YuseiMagic), m_target->breed, SizeF{ flyerRegion.w - textBox.x - 20 - 20 - 20, textBox.y }, 40);
 		}
 
-		AudioAsset(getData().bgmName).stop();
+		getData().audio.stop(getData().bgmName);
+	}
+
+	bool Wanted::m_isPlanReady() const
+	{
+		// レベルデータが差し替えられて計画が消えていたら、Level のほうで立て直す
+		if (not getData().levelPlan)
+		{
+			return true;
+		}
+
+		return getData().levelPlan->selectionIndices.all([this](const size_t index)
+			{
+				return getData().catTextures.isReady(getData().cats[index]->textureId);
+			})
+			and getData().catTextures.isReady(m_target->textureId);
 	}
 
 	void Wanted::update()
@@ -50,13 +111,14 @@ namespace UFOCat
 		{
 			getData().timer.start();
 		}
-		else if (getData().timer.reachedZero())
+		// 計画した猫のテクスチャが全て読み込めてから移る（普通は発表の間に終わっている）
+		else if (getData().timer.reachedZero() and m_isPlanReady())
 		{
 			changeScene(State::Level, 2s);
 		}
 		else if (2 < getData().timer.sF() and getData().timer.sF() < 4.75)
 		{
-			AudioAsset(Util::AudioSource::SE::Announce).play();
+			getData().audio.play(Util::AudioSource::SE::Announce);
 		}
 		
 # if _DEBUG
@@ -96,7 +158,7 @@ namespace UFOCat
 			m_gui.levelBar.draw();
 		}
 
-		FontAsset(Util::FontFamily::YuseiMagic)(U"見つけるUFOネコは...").drawAt(36, Scene::Center().x, 40);
+		FontAsset(Util::FontFamily::YuseiMagic)(m_Heading).drawAt(36, Scene::Center().x, 40);
 
 		// # チラシ部分
 		{
@@ -108,11 +170,20 @@ namespace UFOCat
 
 			// ターゲット猫の表示
 			{
+				const auto &image = getData().catTextures.get(m_target->textureId).scaled(0.45);
+
 				// シャドウ
-				TextureAsset(Cat(getData().targetId)).scaled(0.45).drawAt(targetOrigin + Point{5, 5}, ColorF{0.4, 0.3, 0.2});
+				image.drawAt(targetOrigin + Point{5, 5}, ColorF{0.4, 0.3, 0.2});
 
-				// 実際の
-				TextureAsset(Cat(getData().targetId)).scaled(0.45).drawAt(targetOrigin);
+				// 実際の 色付けする猫なら毛色で塗り分ける
+				if (m_targetRecolor)
+				{
+					m_targetRecolor->drawAt(image, targetOrigin);
+				}
+				else
+				{
+					image.drawAt(targetOrigin);
+				}
 			}			
 
 			// ## ターゲット猫の各種情報を表示する部分
@@ -130,28 +201,21 @@ namespace UFOCat
 					breedBox = textBox.movedBy(flyerRegion.x + 20, targetOrigin.y + 110).draw(Util::Palette::Brown);
 
 					// その上からテキスト
-					FontAsset(Util::FontFamily::YuseiMagic)(U"猫種").drawAt(20, breedBox.center(), Util::Palette::LightBrownAlt);
+					FontAsset(Util::FontFamily::YuseiMagic)(m_InfoLabels[0]).drawAt(20, breedBox.center(), Util::Palette::LightBrownAlt);
 
 					// 猫種名を表示するエリア、マージン (20) 分調整する
 					const RectF& breedRegion = breedBox.movedBy(breedBox.w + 20, 0).setSize(flyerRegion.w - breedBox.w - 20 - 20 - 20, breedBox.h);
 
 					// 名前は短いのから長いのもあるので、
-					// エリアから溢れない範囲でフォントサイズを可変にする
-					double fontSize = 40;
-					// このメソッドは矩形内にすべての文字列が収まらなかったら false を返すので
-					while (not FontAsset(Util::FontFamily::YuseiMagic)(U"{}"_fmt(m_target->breed))
-						.draw(fontSize--, breedRegion, Util::Palette::Brown))
-					{
-						// そのとき、描画されてしまった文字列を上から塗りつぶして隠す
-						breedRegion.draw(Util::Palette::LightBrownAlt);
-					}
+					// エリアから溢れない範囲でフォントサイズを可変にする（サイズはコンストラクタで求めてある）
+					FontAsset(Util::FontFamily::YuseiMagic)(m_target->breed).draw(m_breedFontSize, breedRegion, Util::Palette::Brown);
 				}
 
 				// ### 毛色の表示領域
 				{
 					// さっきのを下に動かしたもの
 					colorBox = breedBox.movedBy(0, 40).draw(Util::Palette::Brown);
-					FontAsset(Util::FontFamily::YuseiMagic)(U"毛色").drawAt(20, colorBox.center(), Util::Palette::LightBrownAlt);
+					FontAsset(Util::FontFamily::YuseiMagic)(m_InfoLabels[1]).drawAt(20, colorBox.center(), Util::Palette::LightBrownAlt);
 
 					// 次々と色情報を表示する際に、基準にする前の表示範囲を保持する
 					RectF previousRegion{ colorBox };
@@ -166,7 +230,7 @@ namespace UFOCat
 				// ### 模様の表示領域
 				{
 					patternBox = colorBox.movedBy(0, 40).draw(Util::Palette::Brown);
-					FontAsset(Util::FontFamily::YuseiMagic)(U"模様").drawAt(20, patternBox.center(), Util::Palette::LightBrownAlt);
+					FontAsset(Util::FontFamily::YuseiMagic)(m_InfoLabels[2]).drawAt(20, patternBox.center(), Util::Palette::LightBrownAlt);
 
 					// 模様名を表示するエリア、マージン (20) 分調整する
 					const RectF& patternRegion = patternBox.movedBy(patternBox.w + 20, 0).setSize(flyerRegion.w - patternBox.w - 20 - 20 - 20, patternBox.h);
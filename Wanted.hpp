@@ -11,6 +11,9 @@ namespace UFOCat
 		/// @brief ターゲットの情報
 		std::shared_ptr<CatData> m_target = nullptr;
 
+		/// @brief ターゲットを毛色で色付けして描画する場合の情報
+		Optional<CatRecolor> m_targetRecolor;
+
 		/// @brief GUI 要素
 		struct
 		{
@@ -22,6 +25,15 @@ namespace UFOCat
 		}
 		m_gui;
 
+		/// @brief 猫種名のフォントサイズ 猫種名も表示するエリアもシーンの間は変わらないので、初めに求めておく
+		double m_breedFontSize = 0.0;
+
+		/// @brief 手配書の見出し
+		constexpr static StringView m_Heading = U"見つけるUFOネコは...";
+
+		/// @brief ターゲット猫の情報の各項目の見出し（猫種、毛色、模様の順）
+		constexpr static std::array<StringView, 3> m_InfoLabels = { U"猫種", U"毛色", U"模様" };
+
 		/// @brief ターゲット猫の毛色データを、色アイコンと色名で表示するためのコンポーネント
 		/// @param name 色名
 		/// @param color 色
@@ -30,6 +42,10 @@ namespace UFOCat
 		/// @return アイコンとマージン、色名の表示領域全てを足した範囲を RectF で返す
 		RectF m_showColorData(String name, Color color, Vec2 leftCenter, double size) const;
 
+		/// @brief 次のレベルで使う猫のテクスチャが全て読み込めているかどうか
+		/// @return 読み込めていれば `true`
+		bool m_isPlanReady() const;
+
 	public:
 
 		Wanted(const InitData &init);